@@ -23,6 +23,7 @@ Sample demonstrating parallel rendering of the distinct asteroids massive
 
 #include "AsteroidsApp.h"
 #include "AsteroidsAppController.h"
+#include "AsteroidsComplexity.h"
 
 #include <Methane/Graphics/AppCameraController.h>
 #include <Methane/Data/TimeAnimation.hpp>
@@ -33,32 +34,12 @@ Sample demonstrating parallel rendering of the distinct asteroids massive
 #include <thread>
 #include <array>
 #include <map>
+#include <chrono>
+#include <iostream>
 
 namespace Methane::Samples
 {
 
-struct MutableParameters
-{
-    uint32_t instances_count;
-    uint32_t unique_mesh_count;
-    uint32_t textures_count;
-    float    scale_ratio;
-};
-
-constexpr uint32_t g_max_complexity = 9;
-static const std::array<MutableParameters, g_max_complexity+1> g_mutable_parameters{ {
-    { 1000U,  35U,   10U, 0.6F  }, // 0
-    { 2000U,  50U,   10U, 0.5F  }, // 1
-    { 3000U,  75U,   20U, 0.45F }, // 2
-    { 4000U,  100U,  20U, 0.4F  }, // 3
-    { 5000U,  200U,  30U, 0.33F }, // 4
-    { 10000U, 300U,  30U, 0.3F  }, // 5
-    { 15000U, 400U,  40U, 0.27F }, // 6
-    { 20000U, 500U,  40U, 0.23F }, // 7
-    { 35000U, 750U,  50U, 0.2F  }, // 8
-    { 50000U, 1000U, 50U, 0.17F }, // 9
-} };
-
 [[nodiscard]]
 inline uint32_t GetDefaultComplexity()
 {
@@ -69,12 +50,6 @@ inline uint32_t GetDefaultComplexity()
 #endif
 }
 
-[[nodiscard]]
-inline const MutableParameters& GetMutableParameters(uint32_t complexity)
-{
-    return g_mutable_parameters[std::min(complexity, g_max_complexity)];
-}
-
 [[nodiscard]]
 inline const MutableParameters& GetMutableParameters()
 {
@@ -98,8 +73,11 @@ static const std::map<pin::Keyboard::State, AsteroidsAppAction> g_asteroids_acti
     { { pin::Keyboard::Key::Num7         }, AsteroidsAppAction::SetComplexity7              },
     { { pin::Keyboard::Key::Num8         }, AsteroidsAppAction::SetComplexity8              },
     { { pin::Keyboard::Key::Num9         }, AsteroidsAppAction::SetComplexity9              },
+    { { pin::Keyboard::Key::T            }, AsteroidsAppAction::ExportFrameTimings          },
 };
 
+static const double                 g_benchmark_time_step_sec = 1.0 / 60.0;
+static const double                 g_bytes_per_megabyte      = 1024.0 * 1024.0;
 static const float                  g_scene_scale = 15.F;
 static const hlslpp::SceneConstants g_scene_constants{
     .light_color = { 1.F, 1.F, 1.F, 1.F },
@@ -108,6 +86,11 @@ static const hlslpp::SceneConstants g_scene_constants{
     .light_specular_factor = 30.F
 };
 
+static std::string FormatMegabytes(uint64_t bytes)
+{
+    return fmt::format("{:.2f} MB", static_cast<double>(bytes) / g_bytes_per_megabyte);
+}
+
 void AsteroidsFrame::ReleaseScreenPassAttachmentTextures()
 {
     META_FUNCTION_TASK();
@@ -167,13 +150,14 @@ AsteroidsApp::AsteroidsApp()
             .random_seed              = 1123U,
             .orbit_radius_ratio       = 13.F,
             .disc_radius_ratio        = 4.F,
-            .mesh_lod_min_screen_size = 0.06F,
+            .mesh_lod_screen_error    = 2.F,
             .min_asteroid_scale_ratio = GetMutableParameters().scale_ratio / 10.F,
             .max_asteroid_scale_ratio = GetMutableParameters().scale_ratio,
             .textures_array_enabled = true,
             .depth_reversed = true
         })
     , m_asteroids_complexity(GetDefaultComplexity())
+    , m_content_executor(std::max(1U, std::thread::hardware_concurrency() / 2U))
 {
     META_FUNCTION_TASK();
 
@@ -189,16 +173,6 @@ AsteroidsApp::AsteroidsApp()
     m_light_camera.SetParameters({ -300.F, 300.F, 90.F });
     m_light_camera.Resize(Data::FloatSize(120.F, 120.F));
 
-    AddInputControllers({
-        std::make_shared<AsteroidsAppController>(*this, g_asteroids_action_by_keyboard_state),
-        std::make_shared<gfx::AppCameraController>(m_view_camera,  "VIEW CAMERA"),
-        std::make_shared<gfx::AppCameraController>(m_light_camera, "LIGHT SOURCE",
-            gfx::AppCameraController::ActionByMouseButton   { { pin::Mouse::Button::Right, gfx::ActionCamera::MouseAction::Rotate   } },
-            gfx::AppCameraController::ActionByKeyboardState { { { pin::Keyboard::Key::LeftControl, pin::Keyboard::Key::L }, gfx::ActionCamera::KeyboardAction::Reset } },
-            gfx::AppCameraController::ActionByKeyboardKey   { }
-        )
-    });
-
     const std::string options_group = "Asteroids Options";
     add_option_group(options_group);
     add_option("-c,--complexity",
@@ -218,11 +192,32 @@ AsteroidsApp::AsteroidsApp()
     add_option("-s,--subdiv-count", m_asteroids_array_settings.subdivisions_count, "mesh subdivisions count")->group(options_group);
     add_option("-t,--texture-array", m_asteroids_array_settings.textures_array_enabled, "texture array enabled")->group(options_group);
     add_option("-r,--parallel-render", m_is_parallel_rendering_enabled, "parallel rendering enabled")->group(options_group);
-
-    // Setup animations
+    add_option("--lod-screen-error", m_asteroids_array_settings.mesh_lod_screen_error, "maximum geometric error of selected mesh LODs projected to screen in pixels")->group(options_group);
+    add_option("--lod-triangle-budget", m_asteroids_array_settings.mesh_lod_triangle_budget, "triangles count of selected mesh LODs held by adjusting LOD screen error (0 - fixed screen error)")->group(options_group);
+    add_option("--belt-pages", m_asteroids_array_settings.belt_pages_count, "streaming belt pages count (0 - streaming disabled)")->group(options_group);
+    add_option("--belt-page-size", m_asteroids_array_settings.belt_page_size, "asteroids count in streaming belt page")->group(options_group);
+    add_option("--subset-batching", m_asteroids_array_settings.subset_batching_enabled, "instanced drawing batched by mesh subsets enabled")->group(options_group);
+    add_option("--indirect-args", m_asteroids_array_settings.indirect_args_enabled, "drawing from indexed draw argument records enabled")->group(options_group);
+    add_option("--balanced-draw", m_asteroids_array_settings.balanced_draw_enabled, "parallel draws balanced by estimated cost enabled")->group(options_group);
+    add_option("--progressive-startup", m_is_progressive_startup_enabled, "progressive startup with coarse content rendered first enabled")->group(options_group);
+    add_option("--shared-bindings", m_asteroids_array_settings.shared_bindings_enabled, "shared program bindings with instance index in start instance of draws enabled")->group(options_group);
+    add_option("--gpu-motion", m_asteroids_array_settings.gpu_motion_enabled, "asteroid motion evaluated in vertex shader from static parameters enabled (enables subset batching)")->group(options_group);
+    add_option("--collisions", m_asteroids_array_settings.collisions_enabled, "asteroid collisions detection on every simulation tick enabled")->group(options_group);
+    add_option("--gravity", m_asteroids_array_settings.gravity_enabled, "asteroid orbits perturbed by mutual gravity with Barnes-Hut octree enabled (disables GPU motion)")->group(options_group);
+    add_option("--gravity-theta", m_asteroids_array_settings.gravity_theta, "opening angle of Barnes-Hut octree nodes, smaller is more accurate and slower")->group(options_group);
+    add_option("--gravity-tick-rate", m_asteroids_array_settings.gravity_tick_rate, "gravity integration steps rate in Hz")->group(options_group);
+    add_option("--sim-tick-rate", m_asteroids_array_settings.simulation_tick_rate, "fixed simulation tick rate in Hz with model matrices interpolated every frame (0 - simulation on every frame)")->group(options_group);
+    add_option("--thread-affinity", m_thread_affinity_mode, "executor threads affinity (0 - OS scheduling, 1 - pinned to cores, 2 - pinned to NUMA nodes)")->group(options_group);
+    add_option("--timings-frames", m_frame_timings_capacity, "frames count in ring buffer of recorded frame stage timings")->group(options_group);
+    add_option("--frame-time-target", m_frame_time_target_ms, "frame time target in milliseconds held by changing drawn asteroids fraction and mesh LOD bias (0 - governor disabled)")->group(options_group);
+    add_option("--timings-export", m_frame_timings_export_path, "frame timings export path without extension (.csv and .json files are written on exit)")->group(options_group);
+    add_option("--benchmark-frames", m_benchmark_frames_count, "benchmark frames count rendered with fixed time step and input disabled (0 - benchmark disabled)")->group(options_group);
+    add_option("--camera-path", m_camera_path_file, "camera path file with keyframes replayed in benchmark mode (orbit around planet by default)")->group(options_group);
+
+    // Setup animations, which are driven by fixed time step in benchmark mode instead of wall clock
     GetAnimations().push_back(Data::MakeTimeAnimationPtr([this](double elapsed_seconds, double delta_seconds)
     {
-        return Animate(elapsed_seconds, delta_seconds);
+        return IsBenchmarkEnabled() || Animate(elapsed_seconds, delta_seconds);
     }));
 
     // Enable dry updates on pause to keep asteroids in sync with projection matrix dependent on window size which may change
@@ -234,8 +229,33 @@ AsteroidsApp::AsteroidsApp()
 AsteroidsApp::~AsteroidsApp()
 {
     META_FUNCTION_TASK();
-    // Wait for GPU rendering is completed to release resources
+    // Wait for background content generation and GPU rendering are completed to release resources
+    if (m_content_progress_ptr)
+    {
+        m_content_progress_ptr->Cancel();
+    }
+    if (m_content_state_future.valid())
+    {
+        m_content_state_future.wait();
+    }
+    for (const ContentStateFuture& cancelled_content_state_future : m_cancelled_content_state_futures)
+    {
+        cancelled_content_state_future.wait();
+    }
     WaitForRenderComplete();
+
+    // Frame timings of unattended sessions are exported on exit when export path is set
+    if (!m_frame_timings_export_path.empty())
+    {
+        try
+        {
+            ExportFrameTimings();
+        }
+        catch(const std::exception& ex)
+        {
+            META_LOG(fmt::format("Failed to export frame timings: {}", ex.what()));
+        }
+    }
 }
 
 void AsteroidsApp::Init()
@@ -259,6 +279,51 @@ void AsteroidsApp::Init()
     // Screen render pattern and screen passes for all frames are initialized here based on modified settings
     UserInterfaceApp::Init();
 
+    // Frame timings recorder is kept on context reset to accumulate timings of the whole session
+    if (!m_frame_timing_recorder_ptr)
+    {
+        m_frame_timing_recorder_ptr = std::make_unique<FrameTimingRecorder>(std::max(m_frame_timings_capacity, m_benchmark_frames_count + 1U));
+    }
+
+    // Frame time governor is kept on context reset with its quality, which is applied to every created asteroids array
+    if (!m_frame_time_governor_ptr && m_frame_time_target_ms > 0.0)
+    {
+        m_frame_time_governor_ptr = std::make_unique<FrameTimeGovernor>(FrameTimeGovernor::Settings{ .target_frame_seconds = m_frame_time_target_ms / 1000.0 });
+    }
+
+    // Gravity perturbations are integrated on CPU, so asteroid positions can not be evaluated in vertex shader
+    if (m_asteroids_array_settings.gravity_enabled)
+    {
+        m_asteroids_array_settings.gpu_motion_enabled = false;
+    }
+
+    // GPU motion is implemented only for instanced drawing batched by mesh subsets
+    if (m_asteroids_array_settings.gpu_motion_enabled)
+    {
+        m_asteroids_array_settings.subset_batching_enabled = true;
+    }
+
+    // Input controllers are added after command-line options are parsed, since user input is disabled in benchmark mode
+    if (!m_is_input_initialized)
+    {
+        InitInput();
+    }
+
+    // Executor workers are pinned before content generation and asteroids update tasks are started,
+    // render context executor is pinned again when it was recreated with context reset
+    if (m_thread_affinity_mode != ThreadAffinity::Mode::None)
+    {
+        tf::Executor& render_executor = GetRenderContext().GetParallelExecutor();
+        if (!m_thread_affinity_ptr || &m_thread_affinity_ptr->GetExecutor() != &render_executor)
+        {
+            m_thread_affinity_ptr = std::make_unique<ThreadAffinity>(render_executor, m_thread_affinity_mode);
+        }
+        if (!m_content_thread_affinity_ptr)
+        {
+            m_content_thread_affinity_ptr = std::make_unique<ThreadAffinity>(m_content_executor, m_thread_affinity_mode);
+        }
+    }
+
     const rhi::RenderContext& context = GetRenderContext();
     rhi::CommandQueue render_cmd_queue = context.GetRenderCommandKit().GetQueue();
     const rhi::RenderContext::Settings& context_settings = context.GetSettings();
@@ -310,13 +375,7 @@ void AsteroidsApp::Init()
         }
     );
 
-    // Create asteroids array
-    m_asteroids_array_ptr = m_asteroids_array_state_ptr
-                          ? std::make_unique<AsteroidsArray>(render_cmd_queue, m_asteroids_render_pattern, m_asteroids_array_settings, *m_asteroids_array_state_ptr)
-                          : std::make_unique<AsteroidsArray>(render_cmd_queue, m_asteroids_render_pattern, m_asteroids_array_settings);
-
-    const auto       constants_data_size         = static_cast<Data::Size>(sizeof(hlslpp::SceneConstants));
-    const Data::Size asteroid_uniforms_data_size = m_asteroids_array_ptr->GetUniformsBufferSize();
+    const auto constants_data_size = static_cast<Data::Size>(sizeof(hlslpp::SceneConstants));
 
     // Create constants buffer for frame rendering
     m_const_buffer = context.CreateBuffer(rhi::BufferSettings::ForConstantBuffer(constants_data_size));
@@ -351,10 +410,6 @@ void AsteroidsApp::Init()
         // Rendering command lists sequence
         frame.execute_cmd_list_set = CreateExecuteCommandListSet(frame);
 
-        // Create uniforms buffer for Asteroids array rendering
-        frame.asteroids.uniforms_buffer = context.CreateBuffer(rhi::BufferSettings::ForConstantBuffer(asteroid_uniforms_data_size, true, true));
-        frame.asteroids.uniforms_buffer.SetName(fmt::format("Asteroids Array Uniforms Buffer {}", frame.index));
-
         // Resource bindings for Sky-Box rendering
         std::tie(frame.sky_box.program_bindings, frame.sky_box.uniforms_argument_binding_ptr) = m_sky_box.CreateProgramBindings(frame.index);
         frame.sky_box.program_bindings.SetName(fmt::format("Space Sky-Box Bindings {}", frame.index));
@@ -362,19 +417,239 @@ void AsteroidsApp::Init()
         // Resource bindings for Planet rendering
         std::tie(frame.planet.program_bindings, frame.planet.uniforms_argument_binding_ptr) = m_planet_ptr->CreateProgramBindings(m_const_buffer, frame.index);
         frame.planet.program_bindings.SetName(fmt::format("Planet Bindings {}", frame.index));
+    }
 
-        // Resource bindings for Asteroids rendering
-        frame.asteroids = m_asteroids_array_ptr->CreateProgramBindings(m_const_buffer,
-                                                                       frame.asteroids.uniforms_buffer,
-                                                                       frame.index);
+    // Create asteroids array with per-frame uniforms buffers and bindings
+    CreateAsteroidsArray();
+
+    CompleteInitialization();
+    META_LOG(GetParametersString());
+}
+
+void AsteroidsApp::CreateAsteroidsArray()
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsApp::CreateAsteroidsArray");
+
+    const rhi::RenderContext& context = GetRenderContext();
+    const rhi::CommandQueue render_cmd_queue = context.GetRenderCommandKit().GetQueue();
+
+    // Progressive startup renders coarse content generated first, while full content is generated in background
+    const bool is_progressive_startup = m_is_progressive_startup_enabled && !m_asteroids_array_state_ptr;
+    const AsteroidsArray::Settings asteroids_array_settings = is_progressive_startup
+                                                            ? AsteroidsArray::GetCoarseContentSettings(m_asteroids_array_settings)
+                                                            : m_asteroids_array_settings;
+    if (!m_asteroids_array_state_ptr)
+    {
+        m_asteroids_array_state_ptr = std::make_shared<AsteroidsArray::ContentState>(context.GetParallelExecutor(), asteroids_array_settings);
+    }
+    m_asteroids_array_ptr = std::make_unique<AsteroidsArray>(render_cmd_queue, m_asteroids_render_pattern, asteroids_array_settings, *m_asteroids_array_state_ptr);
+    m_asteroids_array_ptr->SetFrameTimingRecorder(m_frame_timing_recorder_ptr.get());
+    m_asteroids_array_ptr->SetThreadAffinity(m_thread_affinity_ptr.get());
+    ApplyFrameTimeGovernorQuality();
+
+    for(AsteroidsFrame& frame : GetFrames())
+    {
+        frame.asteroids = CreateAsteroidsBindings(*m_asteroids_array_ptr, frame.index);
     }
 
     // Update initial resource states before asteroids drawing without applying barriers on GPU (automatic state propagation from Common state works),
     // which is required for correct automatic resource barriers to be set after asteroids drawing, on planet drawing
     m_asteroids_array_ptr->CreateBeginningResourceBarriers(&m_const_buffer).ApplyTransitions();
 
-    CompleteInitialization();
-    META_LOG(GetParametersString());
+    if (is_progressive_startup)
+    {
+        StartAsteroidsContentGeneration();
+    }
+}
+
+void AsteroidsApp::InitInput()
+{
+    META_FUNCTION_TASK();
+    m_is_input_initialized = true;
+
+    if (IsBenchmarkEnabled())
+    {
+        // View and light cameras are replayed along the keyframed path in benchmark mode
+        m_camera_path_ptr = m_camera_path_file.empty()
+                          ? std::make_unique<CameraPath>(CameraPath::CreateOrbit(m_view_camera.GetOrientation(), m_light_camera.GetOrientation(),
+                                                                                 g_benchmark_time_step_sec * m_benchmark_frames_count))
+                          : std::make_unique<CameraPath>(CameraPath::LoadFromFile(m_camera_path_file));
+        return;
+    }
+
+    AddInputControllers({
+        std::make_shared<AsteroidsAppController>(*this, g_asteroids_action_by_keyboard_state),
+        std::make_shared<gfx::AppCameraController>(m_view_camera,  "VIEW CAMERA"),
+        std::make_shared<gfx::AppCameraController>(m_light_camera, "LIGHT SOURCE",
+            gfx::AppCameraController::ActionByMouseButton   { { pin::Mouse::Button::Right, gfx::ActionCamera::MouseAction::Rotate   } },
+            gfx::AppCameraController::ActionByKeyboardState { { { pin::Keyboard::Key::LeftControl, pin::Keyboard::Key::L }, gfx::ActionCamera::KeyboardAction::Reset } },
+            gfx::AppCameraController::ActionByKeyboardKey   { }
+        )
+    });
+}
+
+AsteroidsApp::AsteroidMeshBufferBindings AsteroidsApp::CreateAsteroidsBindings(const AsteroidsArray& asteroids_array, Data::Index frame_index) const
+{
+    META_FUNCTION_TASK();
+
+    // Create uniforms buffer for Asteroids array rendering with aligned uniforms slot per instance,
+    // which is not needed for subset batching and shared bindings reading compact instance uniforms from structured buffer
+    rhi::Buffer uniforms_buffer;
+    if (!asteroids_array.IsInstanceUniformsBufferUsed())
+    {
+        uniforms_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForConstantBuffer(asteroids_array.GetUniformsBufferSize(), true, true));
+        uniforms_buffer.SetName(fmt::format("Asteroids Array Uniforms Buffer {}", frame_index));
+    }
+
+    return asteroids_array.CreateProgramBindings(m_const_buffer, uniforms_buffer, frame_index);
+}
+
+void AsteroidsApp::StartAsteroidsContentGeneration()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL(m_asteroids_array_ptr);
+
+    // Previous generation started for outdated settings is cancelled without waiting,
+    // its future is kept until the remaining generation tasks are completed and the result is discarded
+    if (m_content_state_future.valid())
+    {
+        m_content_progress_ptr->Cancel();
+        m_cancelled_content_state_futures.emplace_back(std::move(m_content_state_future));
+    }
+    if (m_pending_asteroids_array_ptr)
+    {
+        RetireAsteroids(std::move(m_pending_asteroids_array_ptr), std::move(m_pending_asteroids_bindings));
+        m_pending_asteroids_bindings.clear();
+    }
+
+    const AsteroidsArray::Settings& prev_settings = m_asteroids_array_ptr->GetSettings();
+    m_content_progress_ptr     = std::make_shared<AsteroidsArray::ContentProgress>(
+        AsteroidsArray::ContentState::GetGenerationStepsCount(m_asteroids_array_settings, &prev_settings));
+    m_content_progress_percent = 0U;
+
+    // Content state is generated on the dedicated executor with reduced workers count,
+    // so that parallel executor of the render context is not saturated while rendering current asteroids
+    m_content_state_future = std::async(std::launch::async,
+        [this, settings = m_asteroids_array_settings, prev_settings, prev_state_ptr = m_asteroids_array_ptr->GetState(), progress_ptr = m_content_progress_ptr]()
+        {
+            return std::make_shared<AsteroidsArray::ContentState>(m_content_executor, settings, *prev_state_ptr, prev_settings, progress_ptr.get());
+        });
+}
+
+void AsteroidsApp::UpdateAsteroidsContentGeneration()
+{
+    META_FUNCTION_TASK();
+    ReleaseRetiredAsteroids();
+    std::erase_if(m_cancelled_content_state_futures,
+        [](const ContentStateFuture& content_state_future)
+        {
+            return content_state_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+
+    if (m_content_state_future.valid())
+    {
+        if (m_content_state_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            const auto content_progress_percent = static_cast<uint32_t>(m_content_progress_ptr->GetRatio() * 100.F);
+            if (content_progress_percent != m_content_progress_percent)
+            {
+                m_content_progress_percent = content_progress_percent;
+                UpdateParametersText();
+            }
+            return;
+        }
+
+        m_asteroids_array_state_ptr = m_content_state_future.get();
+        if (AsteroidsArray::IsResizable(m_asteroids_array_ptr->GetSettings(), m_asteroids_array_settings))
+        {
+            // Asteroids array keeps its render state, mesh buffers and textures, so only uniforms and bindings are re-created,
+            // while bindings of the previous size are retired until frames in flight are rendered
+            META_SCOPE_TIMER("AsteroidsApp::UpdateAsteroidsContentGeneration::Resize");
+            AsteroidsBindings prev_asteroids_bindings;
+            m_asteroids_array_ptr->Resize(m_asteroids_array_settings, *m_asteroids_array_state_ptr);
+            for(AsteroidsFrame& frame : GetFrames())
+            {
+                prev_asteroids_bindings.emplace_back(std::move(frame.asteroids));
+                frame.asteroids = CreateAsteroidsBindings(*m_asteroids_array_ptr, frame.index);
+            }
+            RetireAsteroids(nullptr, std::move(prev_asteroids_bindings));
+            m_content_progress_ptr.reset();
+            m_asteroids_array_ptr->CreateBeginningResourceBarriers(&m_const_buffer).ApplyTransitions();
+            UpdateParametersText();
+            return;
+        }
+
+        // Render state and mesh buffers of the generated content are created on the first frame after generation,
+        // while other GPU resources are created on the following frames
+        META_SCOPE_TIMER("AsteroidsApp::UpdateAsteroidsContentGeneration::CreateArray");
+        const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
+        m_pending_asteroids_array_ptr = std::make_shared<AsteroidsArray>(render_cmd_queue, m_asteroids_render_pattern,
+                                                                         m_asteroids_array_settings, *m_asteroids_array_state_ptr,
+                                                                         AsteroidsArray::ResourcesCreation::Deferred);
+        return;
+    }
+
+    if (!m_pending_asteroids_array_ptr)
+        return;
+
+    // Textures and instance resources are created one per frame
+    if (!m_pending_asteroids_array_ptr->IsResident())
+    {
+        m_pending_asteroids_array_ptr->CreateNextDeferredResource();
+        return;
+    }
+
+    // Program bindings are created for one frame buffer per frame
+    if (m_pending_asteroids_bindings.size() < GetFrames().size())
+    {
+        META_SCOPE_TIMER("AsteroidsApp::UpdateAsteroidsContentGeneration::CreateBindings");
+        const auto frame_index = static_cast<Data::Index>(m_pending_asteroids_bindings.size());
+        m_pending_asteroids_bindings.emplace_back(CreateAsteroidsBindings(*m_pending_asteroids_array_ptr, frame_index));
+        return;
+    }
+
+    // Asteroids array and bindings of all frames are swapped at once when all resources are ready,
+    // previous resources are retired until GPU has finished rendering of the frames in flight
+    META_SCOPE_TIMER("AsteroidsApp::UpdateAsteroidsContentGeneration::Swap");
+    AsteroidsBindings prev_asteroids_bindings;
+    for(AsteroidsFrame& frame : GetFrames())
+    {
+        prev_asteroids_bindings.emplace_back(std::move(frame.asteroids));
+        frame.asteroids = std::move(m_pending_asteroids_bindings[frame.index]);
+    }
+    RetireAsteroids(std::move(m_asteroids_array_ptr), std::move(prev_asteroids_bindings));
+    m_asteroids_array_ptr = std::move(m_pending_asteroids_array_ptr);
+    m_asteroids_array_ptr->SetFrameTimingRecorder(m_frame_timing_recorder_ptr.get());
+    m_asteroids_array_ptr->SetThreadAffinity(m_thread_affinity_ptr.get());
+    ApplyFrameTimeGovernorQuality();
+    m_pending_asteroids_bindings.clear();
+    m_content_progress_ptr.reset();
+    m_asteroids_array_ptr->CreateBeginningResourceBarriers(&m_const_buffer).ApplyTransitions();
+    UpdateParametersText();
+}
+
+void AsteroidsApp::RetireAsteroids(Ptr<AsteroidsArray> asteroids_array_ptr, AsteroidsBindings asteroids_bindings)
+{
+    META_FUNCTION_TASK();
+
+    // Frame buffer resources are reused only after GPU has finished rendering the previous frame with the same buffer,
+    // so resources used by all frames in flight are released after the frame buffers count of frames
+    m_retired_asteroids.push_back(RetiredAsteroids{
+        .array_ptr    = std::move(asteroids_array_ptr),
+        .bindings     = std::move(asteroids_bindings),
+        .frames_count = GetRenderContext().GetSettings().frame_buffers_count
+    });
+}
+
+void AsteroidsApp::ReleaseRetiredAsteroids()
+{
+    META_FUNCTION_TASK();
+    std::erase_if(m_retired_asteroids,
+        [](RetiredAsteroids& retired_asteroids)
+        {
+            return --retired_asteroids.frames_count == 0U;
+        });
 }
 
 bool AsteroidsApp::Resize(const gfx::FrameSize& frame_size, bool is_minimized)
@@ -406,10 +681,18 @@ bool AsteroidsApp::Update()
 {
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsApp::Update");
+    m_frame_timing_recorder_ptr->BeginFrame();
+    UpdateFrameTimeGovernor();
+
+    // Generated asteroids content is swapped before animations update, so that new asteroids are animated in this frame
+    UpdateAsteroidsContentGeneration();
 
     if (!UserInterfaceApp::Update())
         return false;
 
+    if (IsBenchmarkEnabled() && !UpdateBenchmark())
+        return false;
+
     const AsteroidsFrame& frame = GetCurrentFrame();
 
     // Update scene uniforms
@@ -427,6 +710,68 @@ bool AsteroidsApp::Update()
     return true;
 }
 
+void AsteroidsApp::UpdateFrameTimeGovernor()
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_time_governor_ptr || !m_asteroids_array_ptr)
+        return;
+
+    // Uniforms upload is not added to CPU time, since it runs asynchronously with draw encoding
+    using enum FrameTimingRecorder::Stage;
+    const FrameTimingRecorder::StageSeconds stage_seconds = m_frame_timing_recorder_ptr->GetLastFrameStageSeconds();
+    const double cpu_seconds = stage_seconds[static_cast<size_t>(AsteroidsUpdate)] + stage_seconds[static_cast<size_t>(DrawEncoding)]
+                             + stage_seconds[static_cast<size_t>(FinalEncoding)]   + stage_seconds[static_cast<size_t>(Execute)];
+    if (m_frame_time_governor_ptr->AddFrameTimes(stage_seconds[static_cast<size_t>(Frame)], cpu_seconds))
+    {
+        ApplyFrameTimeGovernorQuality();
+        UpdateParametersText();
+    }
+}
+
+void AsteroidsApp::ApplyFrameTimeGovernorQuality() const
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_time_governor_ptr || !m_asteroids_array_ptr)
+        return;
+
+    // LOD bias is applied by asteroids array on top of the screen error or triangle budget changed with mesh LOD complexity keys
+    const FrameTimeGovernor::Quality& quality = m_frame_time_governor_ptr->GetQuality();
+    m_asteroids_array_ptr->SetDrawnFraction(quality.drawn_fraction);
+    m_asteroids_array_ptr->SetMeshLodBias(quality.lod_bias);
+}
+
+bool AsteroidsApp::UpdateBenchmark()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL(m_camera_path_ptr);
+
+    if (m_benchmark_frame_index == m_benchmark_frames_count)
+    {
+        const double benchmark_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_benchmark_start_time).count();
+        std::cout << "Asteroids benchmark of " << m_benchmark_frames_count << " frames with complexity " << m_asteroids_complexity
+                  << " (" << AsteroidsArray::GetTotalInstanceCount(m_asteroids_array_settings) << " asteroids) completed in "
+                  << fmt::format("{:.3f} sec, {:.1f} FPS on average", benchmark_seconds, m_benchmark_frames_count / benchmark_seconds)
+                  << std::endl << m_frame_timing_recorder_ptr->GetSummary() << std::endl;
+        ++m_benchmark_frame_index;
+        Close();
+        return false;
+    }
+    if (m_benchmark_frame_index > m_benchmark_frames_count)
+        return false;
+
+    if (!m_benchmark_frame_index)
+    {
+        m_benchmark_start_time = std::chrono::steady_clock::now();
+    }
+
+    // Simulation time is advanced with fixed time step, so that every benchmark run renders the same sequence of frames
+    const double elapsed_seconds = g_benchmark_time_step_sec * m_benchmark_frame_index;
+    m_camera_path_ptr->Apply(elapsed_seconds, m_view_camera, m_light_camera);
+    Animate(elapsed_seconds, g_benchmark_time_step_sec);
+    ++m_benchmark_frame_index;
+    return true;
+}
+
 bool AsteroidsApp::Animate(double elapsed_seconds, double delta_seconds) const
 {
     META_FUNCTION_TASK();
@@ -459,15 +804,24 @@ bool AsteroidsApp::Render()
     }
     
     // Draw planet and sky-box after asteroids to minimize pixel overdraw
-    m_planet_ptr->Draw(frame.final_cmd_list, frame.planet.program_bindings, GetViewState());
-    m_sky_box.Draw(frame.final_cmd_list, frame.sky_box.program_bindings, GetViewState());
+    {
+        const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr.get(), FrameTimingRecorder::Stage::FinalEncoding);
+        m_planet_ptr->Draw(frame.final_cmd_list, frame.planet.program_bindings, GetViewState());
+        m_sky_box.Draw(frame.final_cmd_list, frame.sky_box.program_bindings, GetViewState());
 
-    RenderOverlay(frame.final_cmd_list);
-    frame.final_cmd_list.Commit();
+        RenderOverlay(frame.final_cmd_list);
+        frame.final_cmd_list.Commit();
+    }
 
     // Execute rendering commands and present frame to screen
-    GetRenderContext().GetRenderCommandKit().GetQueue().Execute(frame.execute_cmd_list_set);
-    GetRenderContext().Present();
+    {
+        const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr.get(), FrameTimingRecorder::Stage::Execute);
+        GetRenderContext().GetRenderCommandKit().GetQueue().Execute(frame.execute_cmd_list_set);
+    }
+    {
+        const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr.get(), FrameTimingRecorder::Stage::Present);
+        GetRenderContext().Present();
+    }
 
     return true;
 }
@@ -477,13 +831,26 @@ void AsteroidsApp::OnContextReleased(rhi::IContext& context)
     META_FUNCTION_TASK();
     META_SCOPE_TIMERS_FLUSH();
 
-    if (m_asteroids_array_ptr)
+    // Content state matching current asteroids array settings is kept to restore asteroids array after context reset
+    if (m_content_state_future.valid())
+    {
+        m_asteroids_array_state_ptr = m_content_state_future.get();
+    }
+    else if (m_pending_asteroids_array_ptr)
+    {
+        m_asteroids_array_state_ptr = m_pending_asteroids_array_ptr->GetState();
+    }
+    else if (m_asteroids_array_ptr)
     {
         m_asteroids_array_state_ptr = m_asteroids_array_ptr->GetState();
     }
+    m_content_progress_ptr.reset();
 
     m_planet_ptr.reset();
     m_asteroids_array_ptr.reset();
+    m_pending_asteroids_array_ptr.reset();
+    m_pending_asteroids_bindings.clear();
+    m_retired_asteroids.clear();
     m_sky_box = {};
     m_const_buffer = {};
     m_asteroids_render_pattern = {};
@@ -499,7 +866,8 @@ void AsteroidsApp::SetAsteroidsComplexity(uint32_t asteroids_complexity)
     if (m_asteroids_complexity == asteroids_complexity)
         return;
 
-    if (GetRenderContext().IsInitialized())
+    const bool is_context_initialized = GetRenderContext().IsInitialized();
+    if (is_context_initialized && !m_asteroids_array_ptr)
     {
         WaitForRenderComplete();
     }
@@ -513,10 +881,19 @@ void AsteroidsApp::SetAsteroidsComplexity(uint32_t asteroids_complexity)
     m_asteroids_array_settings.min_asteroid_scale_ratio = mutable_parameters.scale_ratio / 10.F;
     m_asteroids_array_settings.max_asteroid_scale_ratio = mutable_parameters.scale_ratio;
 
+    if (is_context_initialized && m_asteroids_array_ptr)
+    {
+        // Incremental content state reusing unchanged meshes and textures is generated in background,
+        // while current asteroids array keeps rendering until new one is swapped in at frame boundary
+        StartAsteroidsContentGeneration();
+        UpdateParametersText();
+        return;
+    }
+
     m_asteroids_array_ptr.reset();
     m_asteroids_array_state_ptr.reset();
 
-    if (GetRenderContext().IsInitialized())
+    if (is_context_initialized)
     {
         GetRenderContext().Reset();
     }
@@ -541,6 +918,19 @@ void AsteroidsApp::SetParallelRenderingEnabled(bool is_parallel_rendering_enable
     META_LOG(GetParametersString());
 }
 
+void AsteroidsApp::ExportFrameTimings() const
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_timing_recorder_ptr)
+        return;
+
+    const std::string export_path = m_frame_timings_export_path.empty() ? "AsteroidsFrameTimings" : m_frame_timings_export_path;
+    m_frame_timing_recorder_ptr->ExportCsv(export_path + ".csv");
+    m_frame_timing_recorder_ptr->ExportJson(export_path + ".json");
+    META_LOG(fmt::format("{}\nFrame timings exported to '{}.csv' and '{}.json'",
+                         m_frame_timing_recorder_ptr->GetSummary(), export_path, export_path));
+}
+
 AsteroidsArray& AsteroidsApp::GetAsteroidsArray() const
 {
     META_FUNCTION_TASK();
@@ -548,6 +938,17 @@ AsteroidsArray& AsteroidsApp::GetAsteroidsArray() const
     return *m_asteroids_array_ptr;
 }
 
+AsteroidsArray::MemoryReport AsteroidsApp::GetAsteroidsMemoryReport() const
+{
+    META_FUNCTION_TASK();
+    std::vector<const AsteroidMeshBufferBindings*> frames_bindings;
+    for (const AsteroidsFrame& frame : GetFrames())
+    {
+        frames_bindings.push_back(&frame.asteroids);
+    }
+    return GetAsteroidsArray().GetMemoryReport(frames_bindings);
+}
+
 std::string AsteroidsApp::GetParametersString()
 {
     META_FUNCTION_TASK();
@@ -555,15 +956,89 @@ std::string AsteroidsApp::GetParametersString()
     std::stringstream ss;
     ss << "Asteroids simulation parameters:"
        << std::endl << "  - simulation complexity [0.."  << g_max_complexity << "]: " << m_asteroids_complexity
-       << std::endl << "  - asteroid instances count:     " << m_asteroids_array_settings.instance_count
-       << std::endl << "  - unique meshes count:          " << m_asteroids_array_settings.unique_mesh_count
+       << std::endl << "  - asteroid instances count:     " << AsteroidsArray::GetTotalInstanceCount(m_asteroids_array_settings);
+    if (m_content_progress_ptr)
+    {
+        ss << std::endl << "  - content generation progress:  " << static_cast<uint32_t>(m_content_progress_ptr->GetRatio() * 100.F) << "%";
+    }
+    if (AsteroidsArray::IsBeltStreamingEnabled(m_asteroids_array_settings))
+    {
+        ss << std::endl << "  - streaming belt pages:         " << AsteroidsArray::GetBeltResidentPagesCount(m_asteroids_array_settings)
+                        << " of " << m_asteroids_array_settings.belt_pages_count << " resident";
+    }
+    ss << std::endl << "  - unique meshes count:          " << m_asteroids_array_settings.unique_mesh_count
        << std::endl << "  - mesh subdivisions count:      " << m_asteroids_array_settings.subdivisions_count
        << std::endl << "  - unique textures count:        " << m_asteroids_array_settings.textures_count << " "
        << std::endl << "  - asteroid textures size:       " << static_cast<std::string>(m_asteroids_array_settings.texture_dimensions)
        << std::endl << "  - textures array binding:       " << (m_asteroids_array_settings.textures_array_enabled ? "ON" : "OFF")
-       << std::endl << "  - parallel rendering:           " << (m_is_parallel_rendering_enabled ? "ON" : "OFF")
+       << std::endl << "  - mesh subset batching:         " << (m_asteroids_array_settings.subset_batching_enabled ? "ON" : "OFF")
+       << std::endl << "  - GPU asteroids motion:         " << (m_asteroids_array_settings.gpu_motion_enabled ? "ON" : "OFF")
+       << std::endl << "  - indirect draw arguments:      " << (m_asteroids_array_settings.indirect_args_enabled
+                                                           ? (AsteroidsArray::IsMultiDrawIndirectSupported(GetRenderContext()) ? "ON, multi-draw-indirect" : "ON, replayed on CPU")
+                                                           : "OFF")
+       << std::endl << "  - shared program bindings:      " << (m_asteroids_array_settings.shared_bindings_enabled ? "ON" : "OFF")
+       << std::endl << "  - balanced parallel draws:      " << (m_asteroids_array_settings.balanced_draw_enabled ? "ON" : "OFF");
+    if (m_frame_time_governor_ptr)
+    {
+        const FrameTimeGovernor::Quality& quality = m_frame_time_governor_ptr->GetQuality();
+        ss << std::endl << "  - frame time governor:          " << fmt::format("{:.1f} of {:.1f} ms", m_frame_time_governor_ptr->GetFrameSeconds() * 1000.0,
+                                                                                    m_frame_time_target_ms)
+                        << (m_frame_time_governor_ptr->IsCpuBound() ? " CPU bound, " : " not CPU bound, ")
+                        << static_cast<uint32_t>(quality.drawn_fraction * 100.F) << "% drawn, LOD bias " << fmt::format("{:.2f}", quality.lod_bias);
+    }
+    if (m_asteroids_array_ptr)
+    {
+        ss << std::endl << "  - mesh LOD triangles count:     " << m_asteroids_array_ptr->GetMeshLodTrianglesCount()
+                        << " at " << m_asteroids_array_ptr->GetMeshLodScreenError() << " px screen error";
+        if (m_asteroids_array_ptr->GetMeshLodTriangleBudget())
+            ss << " of " << m_asteroids_array_ptr->GetMeshLodTriangleBudget() << " budget";
+    }
+    if (m_asteroids_array_settings.collisions_enabled && m_asteroids_array_ptr)
+    {
+        const AsteroidCollisions::Statistics& collision_statistics = m_asteroids_array_ptr->GetCollisionStatistics();
+        ss << std::endl << "  - asteroid collisions:          " << collision_statistics.events_count
+                        << " of " << collision_statistics.candidate_pairs_count << " candidate pairs";
+    }
+    if (const AsteroidsGravity* gravity_ptr = m_asteroids_array_ptr ? m_asteroids_array_ptr->GetGravity() : nullptr)
+    {
+        ss << std::endl << "  - gravity octree nodes:         " << gravity_ptr->GetStatistics().nodes_count
+                        << " with theta " << gravity_ptr->GetSettings().theta
+                        << " at " << gravity_ptr->GetSettings().tick_rate << " Hz";
+    }
+    if (m_asteroids_array_settings.simulation_tick_rate)
+    {
+        ss << std::endl << "  - simulation tick rate:         " << m_asteroids_array_settings.simulation_tick_rate << " Hz";
+    }
+    ss << std::endl << "  - parallel rendering:           " << (m_is_parallel_rendering_enabled ? "ON" : "OFF")
        << std::endl << "  - asteroid animations:          " << (!GetAnimations().IsPaused() ? "ON" : "OFF")
        << std::endl << "  - CPU h/w thread count:         " << std::thread::hardware_concurrency();
+    if (m_thread_affinity_ptr)
+    {
+        ss << std::endl << "  - executor threads affinity:    " << m_thread_affinity_ptr->GetDescription();
+    }
+    if (m_asteroids_array_ptr)
+    {
+        const AsteroidsArray::MemoryReport memory_report = GetAsteroidsMemoryReport();
+        ss << std::endl << "  - asteroids memory total:       " << FormatMegabytes(memory_report.GetTotalBytes())
+           << std::endl << "    - content state retained:     " << FormatMegabytes(memory_report.GetContentStateBytes());
+        for (const AsteroidsArray::MemoryReport::MeshLod& mesh_lod : memory_report.mesh_lods)
+        {
+            ss << std::endl << "    - mesh LOD " << mesh_lod.subdivision_index << " vertices/indices: "
+               << FormatMegabytes(mesh_lod.vertex_bytes) << " / " << FormatMegabytes(mesh_lod.index_bytes);
+        }
+        ss << std::endl << "    - textures CPU / GPU:         " << FormatMegabytes(memory_report.textures_cpu_bytes)
+                                                              << " / " << FormatMegabytes(memory_report.textures_gpu_bytes)
+           << std::endl << "    - asteroid parameters:        " << FormatMegabytes(memory_report.parameters_bytes)
+           << std::endl << "    - static GPU buffers:         " << FormatMegabytes(memory_report.static_buffers_bytes)
+           << std::endl << "    - CPU uniforms staging:       " << FormatMegabytes(memory_report.staging_bytes)
+           << std::endl << "    - frame buffers x " << memory_report.frames_count << ":         " << FormatMegabytes(memory_report.frame_buffers_bytes)
+           << std::endl << "    - program bindings count:     " << memory_report.program_bindings_count;
+    }
+    if (IsBenchmarkEnabled())
+    {
+        ss << std::endl << "  - benchmark frames count:       " << m_benchmark_frames_count
+           << std::endl << "  - benchmark camera path:        " << (m_camera_path_file.empty() ? "orbit" : m_camera_path_file);
+    }
 
     return ss.str();
 }
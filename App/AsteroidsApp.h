@@ -25,10 +25,15 @@ Sample demonstrating parallel rendering of the distinct asteroids massive
 
 #include "Planet.h"
 #include "AsteroidsArray.h"
+#include "CameraPath.h"
+#include "FrameTimeGovernor.h"
 
 #include <Methane/Kit.h>
 #include <Methane/UserInterface/App.hpp>
 
+#include <future>
+#include <chrono>
+
 namespace hlslpp // NOSONAR
 {
 #pragma pack(push, 16)
@@ -90,29 +95,90 @@ public:
     void     SetAsteroidsComplexity(uint32_t asteroids_complexity);
 
     bool     IsParallelRenderingEnabled() const { return m_is_parallel_rendering_enabled; }
+    bool     IsBenchmarkEnabled() const         { return m_benchmark_frames_count > 0U; }
     void     SetParallelRenderingEnabled(bool is_parallel_rendering_enabled);
 
     AsteroidsArray& GetAsteroidsArray() const;
 
+    // Memory breakdown of asteroids content and per-frame resources of all frames
+    AsteroidsArray::MemoryReport GetAsteroidsMemoryReport() const;
+
+    // Exports recorded frame timings to CSV and JSON files and logs stage percentiles
+    void ExportFrameTimings() const;
+
 protected:
     // IContextCallback overrides
     void OnContextReleased(rhi::IContext& context) override;
 
 private:
+    using AsteroidMeshBufferBindings = AsteroidsArray::AsteroidMeshBufferBindings;
+
+    void InitInput();
+    void CreateAsteroidsArray();
+    AsteroidMeshBufferBindings CreateAsteroidsBindings(const AsteroidsArray& asteroids_array, Data::Index frame_index) const;
+    void StartAsteroidsContentGeneration();
+    void UpdateAsteroidsContentGeneration();
+    bool UpdateBenchmark();
+    void UpdateFrameTimeGovernor();
+    void ApplyFrameTimeGovernorQuality() const;
     bool Animate(double elapsed_seconds, double delta_seconds) const;
     rhi::CommandListSet CreateExecuteCommandListSet(const AsteroidsFrame& frame) const;
 
     gfx::ActionCamera                 m_view_camera;
     gfx::ActionCamera                 m_light_camera;
     AsteroidsArray::Settings          m_asteroids_array_settings;
-    uint32_t                          m_asteroids_complexity          = 0U;
-    bool                              m_is_parallel_rendering_enabled = true;
+    uint32_t                          m_asteroids_complexity           = 0U;
+    bool                              m_is_parallel_rendering_enabled  = true;
+    bool                              m_is_progressive_startup_enabled = false;
     rhi::RenderPattern                m_asteroids_render_pattern;
     rhi::Buffer                       m_const_buffer;
     gfx::SkyBox                       m_sky_box;
     Ptr<Planet>                       m_planet_ptr;
     Ptr<AsteroidsArray>               m_asteroids_array_ptr;
     Ptr<AsteroidsArray::ContentState> m_asteroids_array_state_ptr;
+    UniquePtr<FrameTimingRecorder>    m_frame_timing_recorder_ptr;
+    uint32_t                          m_frame_timings_capacity = 4096U;
+    std::string                       m_frame_timings_export_path;
+    double                            m_frame_time_target_ms = 0.0;
+    UniquePtr<FrameTimeGovernor>      m_frame_time_governor_ptr;
+    bool                              m_is_input_initialized = false;
+
+    // Deterministic benchmark with fixed time step and camera path replay
+    uint32_t                              m_benchmark_frames_count = 0U;
+    uint32_t                              m_benchmark_frame_index  = 0U;
+    std::string                           m_camera_path_file;
+    UniquePtr<CameraPath>                 m_camera_path_ptr;
+    std::chrono::steady_clock::time_point m_benchmark_start_time;
+
+    // Placement of render context and content executor workers on CPU cores or NUMA nodes
+    ThreadAffinity::Mode                  m_thread_affinity_mode = ThreadAffinity::Mode::None;
+    UniquePtr<ThreadAffinity>             m_thread_affinity_ptr;
+    UniquePtr<ThreadAffinity>             m_content_thread_affinity_ptr;
+
+    // Background content generation with hot swap of asteroids array at frame boundary
+    using AsteroidsBindings    = std::vector<AsteroidMeshBufferBindings>;
+    using ContentStateFuture   = std::future<Ptr<AsteroidsArray::ContentState>>;
+    using ContentStateFutures  = std::vector<ContentStateFuture>;
+
+    // Replaced asteroids array and bindings are released when GPU has finished rendering of the frames in flight
+    struct RetiredAsteroids
+    {
+        Ptr<AsteroidsArray> array_ptr;
+        AsteroidsBindings   bindings;
+        uint32_t            frames_count; // frames left until retired resources are not used by GPU
+    };
+
+    void RetireAsteroids(Ptr<AsteroidsArray> asteroids_array_ptr, AsteroidsBindings asteroids_bindings);
+    void ReleaseRetiredAsteroids();
+
+    tf::Executor                                   m_content_executor;
+    Ptr<AsteroidsArray::ContentProgress>           m_content_progress_ptr;
+    ContentStateFuture                             m_content_state_future;
+    ContentStateFutures                            m_cancelled_content_state_futures;
+    uint32_t                                       m_content_progress_percent = 0U;
+    Ptr<AsteroidsArray>                            m_pending_asteroids_array_ptr;
+    AsteroidsBindings                              m_pending_asteroids_bindings;
+    std::vector<RetiredAsteroids>                  m_retired_asteroids;
 };
 
 } // namespace Methane::Samples
@@ -27,6 +27,8 @@ Asteroids application controller.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+
 namespace Methane::Samples
 {
 
@@ -61,12 +63,19 @@ void AsteroidsAppController::OnKeyboardStateAction(AsteroidsAppAction action)
         m_asteroids_app.GetAsteroidsArray().SetMeshLodColoringEnabled(!m_asteroids_app.GetAsteroidsArray().IsMeshLodColoringEnabled());
         break;
 
+    // Triangle budget is changed instead of screen error, when screen error is adjusted by the triangle budget controller
     case IncreaseMeshLodComplexity:
-        m_asteroids_app.GetAsteroidsArray().SetMinMeshLodScreenSize(m_asteroids_app.GetAsteroidsArray().GetMinMeshLodScreenSize() / 2.F);
+        if (AsteroidsArray& asteroids_array = m_asteroids_app.GetAsteroidsArray(); asteroids_array.GetMeshLodTriangleBudget())
+            asteroids_array.SetMeshLodTriangleBudget(asteroids_array.GetMeshLodTriangleBudget() * 2U);
+        else
+            asteroids_array.SetMeshLodScreenError(asteroids_array.GetMeshLodScreenError() / 2.F);
         break;
 
     case DecreaseMeshLodComplexity:
-        m_asteroids_app.GetAsteroidsArray().SetMinMeshLodScreenSize(m_asteroids_app.GetAsteroidsArray().GetMinMeshLodScreenSize() * 2.F);
+        if (AsteroidsArray& asteroids_array = m_asteroids_app.GetAsteroidsArray(); asteroids_array.GetMeshLodTriangleBudget())
+            asteroids_array.SetMeshLodTriangleBudget(std::max(1U, asteroids_array.GetMeshLodTriangleBudget() / 2U));
+        else
+            asteroids_array.SetMeshLodScreenError(asteroids_array.GetMeshLodScreenError() * 2.F);
         break;
 
     case IncreaseComplexity:
@@ -89,6 +98,10 @@ void AsteroidsAppController::OnKeyboardStateAction(AsteroidsAppAction action)
     case SetComplexity9:
         m_asteroids_app.SetAsteroidsComplexity(static_cast<uint32_t>(action) - static_cast<uint32_t>(SetComplexity0));
         break;
+
+    case ExportFrameTimings:
+        m_asteroids_app.ExportFrameTimings();
+        break;
         
     default:
         META_UNEXPECTED(action);
@@ -117,6 +130,7 @@ std::string AsteroidsAppController::GetKeyboardActionName(AsteroidsAppAction act
     case SetComplexity7:            return "set 7 scene complexity";
     case SetComplexity8:            return "set 8 scene complexity";
     case SetComplexity9:            return "set 9 scene complexity";
+    case ExportFrameTimings:        return "export frame timings";
     default:                                            META_UNEXPECTED_RETURN(action, "");
     }
 }
@@ -50,6 +50,7 @@ enum class AsteroidsAppAction
     SetComplexity7,
     SetComplexity8,
     SetComplexity9,
+    ExportFrameTimings,
 };
 
 namespace pin = Platform::Input;
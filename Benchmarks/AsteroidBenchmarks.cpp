@@ -0,0 +1,69 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidBenchmarks.cpp
+Benchmarks of asteroid mesh and texture generation.
+
+******************************************************************************/
+
+#include <Asteroid.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace Methane;
+using namespace Methane::Samples;
+
+static void AsteroidMeshRandomize(benchmark::State& state)
+{
+    const auto subdivision_index = static_cast<uint32_t>(state.range(0));
+    Asteroid::Mesh base_mesh(subdivision_index, false);
+    base_mesh.Spherify();
+    const Asteroid::Mesh::Adjacency base_mesh_adjacency = base_mesh.GetAdjacency();
+
+    uint32_t random_seed = 1337U;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        Asteroid::Mesh asteroid_mesh(base_mesh);
+        state.ResumeTiming();
+
+        asteroid_mesh.Randomize(random_seed++, base_mesh_adjacency);
+        benchmark::DoNotOptimize(asteroid_mesh.GetDepthRange());
+    }
+    state.counters["vertices"] = static_cast<double>(base_mesh.GetVertexCount());
+}
+
+static void AsteroidFillPerlinNoiseToTexture(benchmark::State& state)
+{
+    const auto             texture_size = static_cast<uint32_t>(state.range(0));
+    const gfx::Dimensions  dimensions(texture_size, texture_size);
+    const gfx::PixelFormat pixel_format = gfx::PixelFormat::RGBA8Unorm;
+    const uint32_t         pixel_size   = gfx::GetPixelSize(pixel_format);
+    const uint32_t         row_stride   = pixel_size * dimensions.GetWidth();
+
+    Data::Bytes texture_data(static_cast<size_t>(dimensions.GetPixelsCount()) * pixel_size, std::byte(255));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        Asteroid::FillPerlinNoiseToTexture(texture_data, dimensions, row_stride, Asteroid::TextureNoiseParameters());
+        benchmark::DoNotOptimize(texture_data.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * dimensions.GetPixelsCount()));
+}
+
+BENCHMARK(AsteroidMeshRandomize)->DenseRange(0, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK(AsteroidFillPerlinNoiseToTexture)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,210 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsArrayBenchmarks.cpp
+Benchmarks of asteroids array content generation, per-asteroid update kernel, collisions detection, orbital picking and gravity integration.
+
+******************************************************************************/
+
+#include "AsteroidsBenchmarkSettings.h"
+
+#include <benchmark/benchmark.h>
+#include <taskflow/algorithm/for_each.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+using namespace Methane;
+using namespace Methane::Samples;
+
+static const hlslpp::float3 g_eye_position(-110.F, 75.F, 210.F);
+
+// Mesh LODs are selected for 1080p viewport with 90 degrees vertical FOV of the view camera in asteroids application
+static const float g_mesh_lod_error_scale = AsteroidsArray::GetMeshLodErrorScale(1080.F, static_cast<float>(std::numbers::pi) / 2.F, 2.F);
+
+static const AsteroidsArray::ContentState& GetSharedContentState(uint32_t complexity)
+{
+    static gfx::Camera s_view_camera;
+    static std::map<uint32_t, std::unique_ptr<AsteroidsArray::ContentState>> s_content_state_by_complexity;
+
+    std::unique_ptr<AsteroidsArray::ContentState>& content_state_ptr = s_content_state_by_complexity[complexity];
+    if (!content_state_ptr)
+    {
+        content_state_ptr = std::make_unique<AsteroidsArray::ContentState>(GetBenchmarkExecutor(),
+                                                                            GetBenchmarkAsteroidsSettings(s_view_camera, complexity));
+    }
+    return *content_state_ptr;
+}
+
+static void AsteroidsContentStateConstruction(benchmark::State& state)
+{
+    gfx::Camera view_camera;
+    const auto complexity = static_cast<uint32_t>(state.range(0));
+    const AsteroidsArray::Settings settings = GetBenchmarkAsteroidsSettings(view_camera, complexity);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        AsteroidsArray::ContentState content_state(GetBenchmarkExecutor(), settings);
+        benchmark::DoNotOptimize(content_state.parameters.data());
+    }
+    state.counters["instances"] = static_cast<double>(settings.instance_count);
+}
+
+static void AsteroidsUpdateKernel(benchmark::State& state)
+{
+    const AsteroidsArray::ContentState& content_state = GetSharedContentState(static_cast<uint32_t>(state.range(0)));
+
+    double elapsed_seconds = 0.0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+        for (const Asteroid::Parameters& asteroid_parameters : content_state.parameters)
+        {
+            benchmark::DoNotOptimize(AsteroidsArray::ComputeAsteroidUpdate(asteroid_parameters, content_state.uber_mesh, g_eye_position,
+                                                                           elapsed_radians, g_mesh_lod_error_scale, false));
+        }
+        elapsed_seconds += 1.0 / 60.0;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * content_state.parameters.size()));
+}
+
+static void AsteroidsUpdateKernelParallel(benchmark::State& state)
+{
+    const AsteroidsArray::ContentState& content_state = GetSharedContentState(static_cast<uint32_t>(state.range(0)));
+    std::vector<AsteroidsArray::AsteroidUpdate> asteroid_updates(content_state.parameters.size());
+
+    double elapsed_seconds = 0.0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+        tf::Taskflow update_task_flow;
+        update_task_flow.for_each(content_state.parameters.begin(), content_state.parameters.end(),
+            [&content_state, &asteroid_updates, elapsed_radians](const Asteroid::Parameters& asteroid_parameters)
+            {
+                asteroid_updates[asteroid_parameters.index] = AsteroidsArray::ComputeAsteroidUpdate(asteroid_parameters, content_state.uber_mesh, g_eye_position,
+                                                                                                    elapsed_radians, g_mesh_lod_error_scale, false);
+            }
+        );
+        GetBenchmarkExecutor().run(update_task_flow).get();
+        benchmark::DoNotOptimize(asteroid_updates.data());
+        elapsed_seconds += 1.0 / 60.0;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * content_state.parameters.size()));
+}
+
+static void AsteroidsCollisionsDetection(benchmark::State& state)
+{
+    const AsteroidsArray::ContentState& content_state = GetSharedContentState(static_cast<uint32_t>(state.range(0)));
+
+    AsteroidCollisions::BoundingSpheres bounding_spheres;
+    bounding_spheres.reserve(content_state.parameters.size());
+    for (const Asteroid::Parameters& asteroid_parameters : content_state.parameters)
+    {
+        const AsteroidsArray::AsteroidUpdate asteroid_update = AsteroidsArray::ComputeAsteroidUpdate(asteroid_parameters, content_state.uber_mesh, g_eye_position,
+                                                                                                     0.F, g_mesh_lod_error_scale, false);
+        const hlslpp::float4x4& model_matrix = asteroid_update.uniforms.model_matrix; // transposed
+        bounding_spheres.push_back(AsteroidCollisions::GetBoundingSphere(asteroid_parameters,
+                                                                         hlslpp::float3(model_matrix._m03, model_matrix._m13, model_matrix._m23),
+                                                                         asteroid_update.uniforms.depth_max));
+    }
+
+    AsteroidCollisions collisions;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(collisions.Detect(GetBenchmarkExecutor(), bounding_spheres).data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * bounding_spheres.size()));
+    state.counters["candidate_pairs"] = static_cast<double>(collisions.GetStatistics().candidate_pairs_count);
+    state.counters["collisions"]      = static_cast<double>(collisions.GetStatistics().events_count);
+}
+
+static void AsteroidsOrbitalPick(benchmark::State& state)
+{
+    const AsteroidsArray::ContentState& content_state = GetSharedContentState(static_cast<uint32_t>(state.range(0)));
+    const AsteroidsArray::UberMesh&     uber_mesh     = content_state.uber_mesh;
+
+    AsteroidsOrbitalIndex::MeshDepthMaxima mesh_depth_maxima(uber_mesh.GetInstanceCount(), 0.F);
+    for (uint32_t mesh_instance_index = 0U; mesh_instance_index < uber_mesh.GetInstanceCount(); ++mesh_instance_index)
+    {
+        for (uint32_t subdivision_index = 0U; subdivision_index < uber_mesh.GetSubdivisionsCount(); ++subdivision_index)
+        {
+            mesh_depth_maxima[mesh_instance_index] = std::max(mesh_depth_maxima[mesh_instance_index],
+                uber_mesh.GetSubsetDepthRange(uber_mesh.GetSubsetIndex(mesh_instance_index, subdivision_index)).second);
+        }
+    }
+    const AsteroidsOrbitalIndex orbital_index(content_state.parameters, mesh_depth_maxima);
+
+    // Rays are cast from eye position towards asteroid positions at the picking time, so that every pick has a hit
+    constexpr double elapsed_seconds = 10.0;
+    const auto       elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+    std::vector<AsteroidsOrbitalIndex::Ray> rays;
+    for (size_t asteroid_index = 0U; asteroid_index < content_state.parameters.size(); asteroid_index += 97U)
+    {
+        const Asteroid::Parameters& asteroid_parameters = content_state.parameters[asteroid_index];
+        const hlslpp::float4x4&     scale_translate     = asteroid_parameters.scale_translate_matrix;
+        const hlslpp::float3        asteroid_position   = AsteroidsOrbitalIndex::GetOrbitPosition(
+            hlslpp::float3(scale_translate._m30, scale_translate._m31, scale_translate._m32),
+            asteroid_parameters.orbit_angle_rad - asteroid_parameters.orbit_speed * elapsed_radians);
+        rays.push_back(AsteroidsOrbitalIndex::Ray{ g_eye_position, asteroid_position - g_eye_position });
+    }
+
+    size_t hits_count = 0U;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const AsteroidsOrbitalIndex::Ray& ray : rays)
+        {
+            const std::optional<AsteroidsOrbitalIndex::Hit> hit = orbital_index.Pick(ray, elapsed_seconds);
+            hits_count += hit ? 1U : 0U;
+            benchmark::DoNotOptimize(hit);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rays.size()));
+    state.counters["bands"] = static_cast<double>(orbital_index.GetBandsCount());
+    state.counters["hits"]  = benchmark::Counter(static_cast<double>(hits_count), benchmark::Counter::kAvgIterations);
+}
+
+static void AsteroidsGravityStep(benchmark::State& state)
+{
+    const AsteroidsArray::ContentState& content_state = GetSharedContentState(static_cast<uint32_t>(state.range(0)));
+    AsteroidsGravity gravity(AsteroidsGravity::Settings{ .max_steps_per_update = 1U });
+    gravity.Reset(GetBenchmarkExecutor(), content_state.parameters, 0.0);
+
+    // Every update integrates exactly one step, which rebuilds octree and computes accelerations of all asteroids
+    const double step_seconds    = 1.0 / static_cast<double>(gravity.GetSettings().tick_rate);
+    double       elapsed_seconds = 0.0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        elapsed_seconds += step_seconds;
+        gravity.Update(GetBenchmarkExecutor(), elapsed_seconds);
+        benchmark::DoNotOptimize(gravity.GetPositions().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * content_state.parameters.size()));
+    state.SetComplexityN(static_cast<int64_t>(content_state.parameters.size()));
+    state.counters["nodes"] = static_cast<double>(gravity.GetStatistics().nodes_count);
+}
+
+BENCHMARK(AsteroidsContentStateConstruction)->DenseRange(0, static_cast<int64_t>(g_max_complexity))->Unit(benchmark::kMillisecond)->Iterations(1)->Repetitions(3);
+BENCHMARK(AsteroidsUpdateKernel)->DenseRange(0, static_cast<int64_t>(g_max_complexity))->Unit(benchmark::kMicrosecond);
+BENCHMARK(AsteroidsUpdateKernelParallel)->DenseRange(0, static_cast<int64_t>(g_max_complexity))->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(AsteroidsCollisionsDetection)->DenseRange(0, static_cast<int64_t>(g_max_complexity))->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(AsteroidsOrbitalPick)->DenseRange(0, static_cast<int64_t>(g_max_complexity))->Unit(benchmark::kMicrosecond);
+BENCHMARK(AsteroidsGravityStep)->DenseRange(0, static_cast<int64_t>(g_max_complexity))->Unit(benchmark::kMillisecond)->UseRealTime()->Complexity(benchmark::oNLogN);
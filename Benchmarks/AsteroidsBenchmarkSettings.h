@@ -0,0 +1,65 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsBenchmarkSettings.h
+Asteroids array settings used in benchmarks, matching the settings of Asteroids application.
+
+******************************************************************************/
+
+#pragma once
+
+#include <AsteroidsArray.h>
+#include <AsteroidsComplexity.h>
+
+#include <taskflow/taskflow.hpp>
+
+namespace Methane::Samples
+{
+
+[[nodiscard]]
+inline AsteroidsArray::Settings GetBenchmarkAsteroidsSettings(gfx::Camera& view_camera, uint32_t complexity)
+{
+    const MutableParameters& mutable_parameters = GetMutableParameters(complexity);
+    return AsteroidsArray::Settings
+    {
+        .view_camera              = view_camera,
+        .scale                    = 15.F,
+        .instance_count           = mutable_parameters.instances_count,
+        .unique_mesh_count        = mutable_parameters.unique_mesh_count,
+        .subdivisions_count       = 4U,
+        .textures_count           = mutable_parameters.textures_count,
+        .texture_dimensions       = { 256U, 256U },
+        .random_seed              = 1123U,
+        .orbit_radius_ratio       = 13.F,
+        .disc_radius_ratio        = 4.F,
+        .mesh_lod_screen_error    = 2.F,
+        .min_asteroid_scale_ratio = mutable_parameters.scale_ratio / 10.F,
+        .max_asteroid_scale_ratio = mutable_parameters.scale_ratio,
+        .textures_array_enabled   = true,
+        .depth_reversed           = true
+    };
+}
+
+[[nodiscard]]
+inline tf::Executor& GetBenchmarkExecutor()
+{
+    static tf::Executor s_executor;
+    return s_executor;
+}
+
+} // namespace Methane::Samples
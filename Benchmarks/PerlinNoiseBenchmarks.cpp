@@ -0,0 +1,122 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: PerlinNoiseBenchmarks.cpp
+Benchmarks of multi-octave simplex noise generators for each vector type.
+
+******************************************************************************/
+
+#include <PerlinNoise.h>
+#include <StaticPerlinNoise.hpp>
+
+#include <benchmark/benchmark.h>
+#include <hlsl++.h>
+
+#include <vector>
+
+namespace gfx = Methane::Graphics;
+namespace data = Methane::Data;
+
+constexpr size_t g_noise_positions_count = 4096U;
+
+template<typename VectorType>
+VectorType MakeNoisePosition(float x);
+
+template<> hlslpp::float2    MakeNoisePosition(float x) { return { x, x * 0.5F }; }
+template<> hlslpp::float3    MakeNoisePosition(float x) { return { x, x * 0.5F, x * 0.25F }; }
+template<> hlslpp::float4    MakeNoisePosition(float x) { return { x, x * 0.5F, x * 0.25F, 1.F }; }
+template<> data::RawVector2F MakeNoisePosition(float x) { return data::RawVector2F(x, x * 0.5F); }
+template<> data::RawVector3F MakeNoisePosition(float x) { return data::RawVector3F(x, x * 0.5F, x * 0.25F); }
+template<> data::RawVector4F MakeNoisePosition(float x) { return data::RawVector4F(x, x * 0.5F, x * 0.25F, 1.F); }
+
+template<typename VectorType>
+std::vector<VectorType> MakeNoisePositions()
+{
+    std::vector<VectorType> positions;
+    positions.reserve(g_noise_positions_count);
+    for (size_t i = 0; i < g_noise_positions_count; ++i)
+    {
+        positions.emplace_back(MakeNoisePosition<VectorType>(static_cast<float>(i) * 0.01F));
+    }
+    return positions;
+}
+
+template<typename VectorType>
+static void PerlinNoiseSingle(benchmark::State& state)
+{
+    const gfx::PerlinNoise perlin_noise(0.95F, 4);
+    const std::vector<VectorType> positions = MakeNoisePositions<VectorType>();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const VectorType& position : positions)
+        {
+            benchmark::DoNotOptimize(perlin_noise(position));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+
+template<typename VectorType>
+static void StaticPerlinNoiseSingle(benchmark::State& state)
+{
+    const gfx::StaticPerlinNoise<4> perlin_noise(0.95F);
+    const std::vector<VectorType> positions = MakeNoisePositions<VectorType>();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const VectorType& position : positions)
+        {
+            benchmark::DoNotOptimize(perlin_noise(position));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+
+template<typename VectorType>
+static void PerlinNoiseBatch(benchmark::State& state)
+{
+    const gfx::PerlinNoise perlin_noise(0.95F, 4);
+    const std::vector<VectorType> positions = MakeNoisePositions<VectorType>();
+    std::vector<float> values(positions.size());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        perlin_noise.Evaluate(positions, values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+
+BENCHMARK_TEMPLATE(PerlinNoiseSingle, hlslpp::float2);
+BENCHMARK_TEMPLATE(PerlinNoiseSingle, hlslpp::float3);
+BENCHMARK_TEMPLATE(PerlinNoiseSingle, hlslpp::float4);
+BENCHMARK_TEMPLATE(PerlinNoiseSingle, data::RawVector2F);
+BENCHMARK_TEMPLATE(PerlinNoiseSingle, data::RawVector3F);
+BENCHMARK_TEMPLATE(PerlinNoiseSingle, data::RawVector4F);
+
+BENCHMARK_TEMPLATE(StaticPerlinNoiseSingle, hlslpp::float2);
+BENCHMARK_TEMPLATE(StaticPerlinNoiseSingle, hlslpp::float3);
+BENCHMARK_TEMPLATE(StaticPerlinNoiseSingle, hlslpp::float4);
+BENCHMARK_TEMPLATE(StaticPerlinNoiseSingle, data::RawVector2F);
+BENCHMARK_TEMPLATE(StaticPerlinNoiseSingle, data::RawVector3F);
+BENCHMARK_TEMPLATE(StaticPerlinNoiseSingle, data::RawVector4F);
+
+BENCHMARK_TEMPLATE(PerlinNoiseBatch, hlslpp::float2);
+BENCHMARK_TEMPLATE(PerlinNoiseBatch, hlslpp::float3);
+BENCHMARK_TEMPLATE(PerlinNoiseBatch, hlslpp::float4);
+BENCHMARK_TEMPLATE(PerlinNoiseBatch, data::RawVector2F);
+BENCHMARK_TEMPLATE(PerlinNoiseBatch, data::RawVector3F);
+BENCHMARK_TEMPLATE(PerlinNoiseBatch, data::RawVector4F);
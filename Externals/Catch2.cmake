@@ -0,0 +1,10 @@
+CPMAddPackage(
+    NAME Catch2
+    GITHUB_REPOSITORY catchorg/Catch2
+    VERSION 3.5.2
+    OPTIONS
+        "CATCH_INSTALL_DOCS OFF"
+        "CATCH_INSTALL_EXTRAS OFF"
+)
+
+list(APPEND CMAKE_MODULE_PATH "${Catch2_SOURCE_DIR}/extras")
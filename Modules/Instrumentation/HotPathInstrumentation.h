@@ -0,0 +1,52 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: HotPathInstrumentation.h
+Compile-time instrumentation levels of asteroids simulation hot paths:
+per-item function zones are emitted only at the highest level, while parallel loops
+report one zone per worker chunk with processed items count attached.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <cstdint>
+
+#define ASTEROIDS_INSTRUMENTATION_DISABLED 0 // no zones in hot paths
+#define ASTEROIDS_INSTRUMENTATION_CHUNKS   1 // zone per worker chunk of parallel loops
+#define ASTEROIDS_INSTRUMENTATION_ITEMS    2 // zone per function call of every processed item (asteroid, vertex, noise sample)
+
+#ifndef ASTEROIDS_INSTRUMENTATION_LEVEL
+#define ASTEROIDS_INSTRUMENTATION_LEVEL ASTEROIDS_INSTRUMENTATION_CHUNKS
+#endif
+
+#if ASTEROIDS_INSTRUMENTATION_LEVEL >= ASTEROIDS_INSTRUMENTATION_CHUNKS
+#define ASTEROIDS_CHUNK_TASK(/*const char* */name, /*size_t */items_count) \
+    ZoneScopedN(name);                                                      \
+    ZoneValue(static_cast<uint64_t>(items_count))
+#else
+#define ASTEROIDS_CHUNK_TASK(name, items_count)
+#endif
+
+#if ASTEROIDS_INSTRUMENTATION_LEVEL >= ASTEROIDS_INSTRUMENTATION_ITEMS
+#define ASTEROIDS_HOT_FUNCTION_TASK() META_FUNCTION_TASK()
+#else
+#define ASTEROIDS_HOT_FUNCTION_TASK()
+#endif
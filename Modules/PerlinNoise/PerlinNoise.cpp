@@ -22,11 +22,14 @@ Multi-octave simplex noise generator in range [0, 1]
 ******************************************************************************/
 
 #include "PerlinNoise.h"
-#include <Methane/Instrumentation.h>
+#include <HotPathInstrumentation.h>
+#include <Methane/Checks.hpp>
 
 #include <hlsl++.h>
 #include <FastNoise/FastNoise.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
@@ -41,6 +44,45 @@ template<> float GetPerlinNoise(const FastNoise::Simplex& simplex_noise, const D
 template<> float GetPerlinNoise(const FastNoise::Simplex& simplex_noise, const Data::RawVector3F& pos, int seed) noexcept { return simplex_noise.GenSingle3D(pos[0], pos[1], pos[2], seed); }
 template<> float GetPerlinNoise(const FastNoise::Simplex& simplex_noise, const Data::RawVector4F& pos, int seed) noexcept { return simplex_noise.GenSingle4D(pos[0], pos[1], pos[2], pos[3], seed); }
 
+template<typename VectorType>
+void GetPositionCoordinates(const VectorType& pos, float* coords) noexcept;
+
+template<> void GetPositionCoordinates(const hlslpp::float2& pos, float* coords) noexcept    { hlslpp::store(pos, coords); }
+template<> void GetPositionCoordinates(const hlslpp::float3& pos, float* coords) noexcept    { hlslpp::store(pos, coords); }
+template<> void GetPositionCoordinates(const hlslpp::float4& pos, float* coords) noexcept    { hlslpp::store(pos, coords); }
+
+template<> void GetPositionCoordinates(const Data::RawVector2F& pos, float* coords) noexcept { coords[0] = pos[0]; coords[1] = pos[1]; }
+template<> void GetPositionCoordinates(const Data::RawVector3F& pos, float* coords) noexcept { coords[0] = pos[0]; coords[1] = pos[1]; coords[2] = pos[2]; }
+template<> void GetPositionCoordinates(const Data::RawVector4F& pos, float* coords) noexcept { coords[0] = pos[0]; coords[1] = pos[1]; coords[2] = pos[2]; coords[3] = pos[3]; }
+
+template<size_t dimensions_count>
+using PositionCoordinateArrays = std::array<std::vector<float>, dimensions_count>;
+
+template<size_t dimensions_count>
+void GenPerlinNoiseArray(const FastNoise::Simplex& simplex_noise, float* values, int count,
+                         const PositionCoordinateArrays<dimensions_count>& coords,
+                         const std::array<float, dimensions_count>& offset, int seed);
+
+template<> void GenPerlinNoiseArray(const FastNoise::Simplex& simplex_noise, float* values, int count,
+                                    const PositionCoordinateArrays<2>& coords, const std::array<float, 2>& offset, int seed)
+{
+    simplex_noise.GenPositionArray2D(values, count, coords[0].data(), coords[1].data(), offset[0], offset[1], seed);
+}
+
+template<> void GenPerlinNoiseArray(const FastNoise::Simplex& simplex_noise, float* values, int count,
+                                    const PositionCoordinateArrays<3>& coords, const std::array<float, 3>& offset, int seed)
+{
+    simplex_noise.GenPositionArray3D(values, count, coords[0].data(), coords[1].data(), coords[2].data(),
+                                     offset[0], offset[1], offset[2], seed);
+}
+
+template<> void GenPerlinNoiseArray(const FastNoise::Simplex& simplex_noise, float* values, int count,
+                                    const PositionCoordinateArrays<4>& coords, const std::array<float, 4>& offset, int seed)
+{
+    simplex_noise.GenPositionArray4D(values, count, coords[0].data(), coords[1].data(), coords[2].data(), coords[3].data(),
+                                     offset[0], offset[1], offset[2], offset[3], seed);
+}
+
 PerlinNoise::PerlinNoise(float persistence, size_t octaves_count, int seed)
     : m_weights(GetWeights(persistence, octaves_count))
     , m_norm_multiplier(0.5F / GetWeightsSum(m_weights))
@@ -57,10 +99,23 @@ float PerlinNoise::operator()(const Data::RawVector2F& pos) const noexcept { ret
 float PerlinNoise::operator()(const Data::RawVector3F& pos) const noexcept { return GetValue(pos); }
 float PerlinNoise::operator()(const Data::RawVector4F& pos) const noexcept { return GetValue(pos); }
 
+void PerlinNoise::Evaluate(std::span<const hlslpp::float2> positions, std::span<float> values) const    { EvaluateBatch<2>(positions, values, {}); }
+void PerlinNoise::Evaluate(std::span<const hlslpp::float3> positions, std::span<float> values) const    { EvaluateBatch<3>(positions, values, {}); }
+void PerlinNoise::Evaluate(std::span<const hlslpp::float4> positions, std::span<float> values) const    { EvaluateBatch<4>(positions, values, {}); }
+
+void PerlinNoise::Evaluate(std::span<const Data::RawVector2F> positions, std::span<float> values) const { EvaluateBatch<2>(positions, values, {}); }
+void PerlinNoise::Evaluate(std::span<const Data::RawVector3F> positions, std::span<float> values) const { EvaluateBatch<3>(positions, values, {}); }
+void PerlinNoise::Evaluate(std::span<const Data::RawVector4F> positions, std::span<float> values) const { EvaluateBatch<4>(positions, values, {}); }
+
+void PerlinNoise::Evaluate(std::span<const Data::RawVector3F> positions, std::span<float> values, const Data::RawVector3F& seed_offset) const
+{
+    EvaluateBatch<3>(positions, values, { seed_offset[0], seed_offset[1], seed_offset[2] });
+}
+
 template<typename VectorType>
 float PerlinNoise::GetValue(VectorType pos) const noexcept
 {
-    META_FUNCTION_TASK();
+    ASTEROIDS_HOT_FUNCTION_TASK();
     const FastNoise::Simplex& simplex_noise = GetSimplexNoise();
     float noise = 0.F;
     for (const float weight : m_weights)
@@ -71,6 +126,68 @@ float PerlinNoise::GetValue(VectorType pos) const noexcept
     return noise * m_norm_multiplier + 0.5F;
 }
 
+template<size_t dimensions_count, typename VectorType>
+void PerlinNoise::EvaluateBatch(std::span<const VectorType> positions, std::span<float> values,
+                                const std::array<float, dimensions_count>& offset) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL(values.size(), positions.size());
+    if (positions.empty())
+        return;
+
+    const size_t positions_count = positions.size();
+    const auto   count           = static_cast<int>(positions_count);
+
+    // Convert positions to the structure of arrays layout required by FastNoise SIMD generators
+    PositionCoordinateArrays<dimensions_count> coords;
+    for (std::vector<float>& coord : coords)
+    {
+        coord.resize(positions_count);
+    }
+
+    std::array<float, 4> pos_coords{};
+    for (size_t pos_index = 0; pos_index < positions_count; ++pos_index)
+    {
+        GetPositionCoordinates(positions[pos_index], pos_coords.data());
+        for (size_t dim = 0; dim < dimensions_count; ++dim)
+        {
+            coords[dim][pos_index] = pos_coords[dim];
+        }
+    }
+
+    const FastNoise::Simplex& simplex_noise = GetSimplexNoise();
+    std::vector<float> octave_values(positions_count);
+    std::fill(values.begin(), values.end(), 0.F);
+    std::array<float, dimensions_count> octave_offset = offset;
+
+    for (const float weight : m_weights)
+    {
+        GenPerlinNoiseArray<dimensions_count>(simplex_noise, octave_values.data(), count, coords, octave_offset, m_seed);
+        for (size_t pos_index = 0; pos_index < positions_count; ++pos_index)
+        {
+            values[pos_index] += weight * octave_values[pos_index];
+        }
+
+        // Double the noise frequency for the next octave
+        for (std::vector<float>& coord : coords)
+        {
+            for (float& coord_value : coord)
+            {
+                coord_value *= 2.F;
+            }
+        }
+        for (float& offset_value : octave_offset)
+        {
+            offset_value *= 2.F;
+        }
+    }
+
+    for (float& value : values)
+    {
+        value = value * m_norm_multiplier + 0.5F;
+    }
+}
+
 PerlinNoise::Weights PerlinNoise::GetWeights(float persistence, size_t octaves_count) noexcept
 {
     META_FUNCTION_TASK();
@@ -27,6 +27,8 @@ Multi-octave simplex noise generator in range [0, 1]
 #include <Methane/Graphics/Types.h>
 
 #include <vector>
+#include <array>
+#include <span>
 
 namespace FastNoise
 {
@@ -49,11 +51,29 @@ public:
     [[nodiscard]] float operator()(const Data::RawVector3F& pos) const noexcept;
     [[nodiscard]] float operator()(const Data::RawVector4F& pos) const noexcept;
 
+    // Batched evaluation of noise values for arrays of positions using SIMD position-array generators
+    void Evaluate(std::span<const hlslpp::float2> positions, std::span<float> values) const;
+    void Evaluate(std::span<const hlslpp::float3> positions, std::span<float> values) const;
+    void Evaluate(std::span<const hlslpp::float4> positions, std::span<float> values) const;
+
+    void Evaluate(std::span<const Data::RawVector2F> positions, std::span<float> values) const;
+    void Evaluate(std::span<const Data::RawVector3F> positions, std::span<float> values) const;
+    void Evaluate(std::span<const Data::RawVector4F> positions, std::span<float> values) const;
+
+    // 3D seed-offset mode: noise is evaluated at (position + seed_offset), which decorrelates noise
+    // of different objects without the 4D lookup with constant 4-th coordinate
+    void Evaluate(std::span<const Data::RawVector3F> positions, std::span<float> values, const Data::RawVector3F& seed_offset) const;
+
 private:
     using Weights = std::vector<float>;
 
     template<typename VectorType>
     [[nodiscard]] float GetValue(VectorType v) const noexcept;
+
+    template<size_t dimensions_count, typename VectorType>
+    void EvaluateBatch(std::span<const VectorType> positions, std::span<float> values,
+                       const std::array<float, dimensions_count>& offset) const;
+
     [[nodiscard]] static Weights GetWeights(float persistence, size_t octaves_count) noexcept;
     [[nodiscard]] static float GetWeightsSum(const PerlinNoise::Weights& weights) noexcept;
     [[nodiscard]] const FastNoise::Simplex& GetSimplexNoise() const;
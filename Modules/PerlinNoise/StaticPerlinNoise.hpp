@@ -0,0 +1,125 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: StaticPerlinNoise.hpp
+Multi-octave simplex noise generator in range [0, 1] specialized by octaves count
+at compile time: octave weights and scales are computed with constexpr functions,
+octaves loop is fully unrolled, with no per-sample instrumentation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Vector.hpp>
+#include <Methane/Graphics/Types.h>
+
+#include <FastNoise/FastNoise.h>
+
+#include <array>
+#include <utility>
+
+namespace Methane::Graphics
+{
+
+template<size_t octaves_count>
+class StaticPerlinNoise
+{
+    static_assert(octaves_count > 0, "Perlin noise requires at least one octave.");
+
+public:
+    using Weights = std::array<float, octaves_count>;
+    using Scales  = std::array<float, octaves_count>;
+
+    [[nodiscard]] static constexpr Weights GetWeights(float persistence) noexcept
+    {
+        Weights weights{};
+        for (float& weight : weights)
+        {
+            weight = persistence;
+            persistence *= persistence;
+        }
+        return weights;
+    }
+
+    [[nodiscard]] static constexpr Scales GetOctaveScales(float lacunarity) noexcept
+    {
+        Scales octave_scales{};
+        float octave_scale = 1.F;
+        for (float& scale : octave_scales)
+        {
+            scale = octave_scale;
+            octave_scale *= lacunarity;
+        }
+        return octave_scales;
+    }
+
+    [[nodiscard]] static constexpr float GetNormMultiplier(const Weights& weights) noexcept
+    {
+        float weights_sum = 0.F;
+        for (const float weight : weights)
+        {
+            weights_sum += weight;
+        }
+        return 0.5F / weights_sum;
+    }
+
+    explicit StaticPerlinNoise(const Weights& weights, int seed = 1234, float lacunarity = 2.F)
+        : m_weights(weights)
+        , m_octave_scales(GetOctaveScales(lacunarity))
+        , m_norm_multiplier(GetNormMultiplier(weights))
+        , m_seed(seed)
+        , m_simplex_noise_ptr(FastNoise::New<FastNoise::Simplex>())
+    { }
+
+    explicit StaticPerlinNoise(float persistence = 0.5F, int seed = 1234, float lacunarity = 2.F)
+        : StaticPerlinNoise(GetWeights(persistence), seed, lacunarity)
+    { }
+
+    [[nodiscard]] static constexpr size_t GetOctavesCount() noexcept { return octaves_count; }
+    [[nodiscard]] const Weights& GetWeights() const noexcept         { return m_weights; }
+
+    template<typename VectorType>
+    [[nodiscard]] float operator()(const VectorType& pos) const noexcept
+    {
+        return GetValue(pos, std::make_index_sequence<octaves_count>{});
+    }
+
+private:
+    template<typename VectorType, size_t... octave_indices>
+    [[nodiscard]] float GetValue(const VectorType& pos, std::index_sequence<octave_indices...>) const noexcept
+    {
+        const float noise = (... + (m_weights[octave_indices] * GetSimplexNoise(pos * m_octave_scales[octave_indices])));
+        return noise * m_norm_multiplier + 0.5F;
+    }
+
+    [[nodiscard]] float GetSimplexNoise(const hlslpp::float2& pos) const noexcept    { return m_simplex_noise_ptr->GenSingle2D(pos.x, pos.y, m_seed); }
+    [[nodiscard]] float GetSimplexNoise(const hlslpp::float3& pos) const noexcept    { return m_simplex_noise_ptr->GenSingle3D(pos.x, pos.y, pos.z, m_seed); }
+    [[nodiscard]] float GetSimplexNoise(const hlslpp::float4& pos) const noexcept    { return m_simplex_noise_ptr->GenSingle4D(pos.x, pos.y, pos.z, pos.w, m_seed); }
+
+    [[nodiscard]] float GetSimplexNoise(const Data::RawVector2F& pos) const noexcept { return m_simplex_noise_ptr->GenSingle2D(pos[0], pos[1], m_seed); }
+    [[nodiscard]] float GetSimplexNoise(const Data::RawVector3F& pos) const noexcept { return m_simplex_noise_ptr->GenSingle3D(pos[0], pos[1], pos[2], m_seed); }
+    [[nodiscard]] float GetSimplexNoise(const Data::RawVector4F& pos) const noexcept { return m_simplex_noise_ptr->GenSingle4D(pos[0], pos[1], pos[2], pos[3], m_seed); }
+
+    Weights                                  m_weights;
+    Scales                                   m_octave_scales;
+    float                                    m_norm_multiplier;
+    int                                      m_seed;
+    FastNoise::SmartNode<FastNoise::Simplex> m_simplex_noise_ptr;
+};
+
+} // namespace Methane::Graphics
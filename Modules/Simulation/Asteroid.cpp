@@ -25,19 +25,39 @@ Random generated asteroid model with mesh and texture ready for rendering
 
 #include <Methane/Graphics/RHI/RenderContext.h>
 #include <Methane/Checks.hpp>
-#include <Methane/Instrumentation.h>
+#include <HotPathInstrumentation.h>
 
 #include <PerlinNoise.h>
-#include <FastNoise/FastNoise.h>
+#include <StaticPerlinNoise.hpp>
 
 #include <cmath>
 #include <random>
+#include <vector>
 
 namespace Methane::Samples
 {
 
 using AsteroidColorSchema = std::array<gfx::Color3F, Asteroid::color_schema_size>;
 
+// Offsets of color schemas in the asteroid colors palette
+enum class ColorsPaletteSchema : uint32_t
+{
+    DeepRock = 0U,
+    ShallowRock,
+    DeepIce,
+    ShallowIce,
+    DeepLod,
+    ShallowLod,
+
+    Count
+};
+
+static uint32_t GetColorsPaletteIndex(ColorsPaletteSchema schema, uint32_t color_index)
+{
+    META_CHECK_LESS(color_index, Asteroid::color_schema_size);
+    return static_cast<uint32_t>(schema) * static_cast<uint32_t>(Asteroid::color_schema_size) + color_index;
+}
+
 static gfx::Color3F TransformSrgbToLinear(const gfx::Color3F& srgb_color)
 {
     META_FUNCTION_TASK();
@@ -71,6 +91,51 @@ Asteroid::Mesh::Mesh(uint32_t subdivisions_count, bool randomize)
 }
 
 void Asteroid::Mesh::Randomize(uint32_t random_seed)
+{
+    META_FUNCTION_TASK();
+    Randomize(random_seed, GetAdjacency());
+}
+
+void Asteroid::Mesh::Randomize(uint32_t random_seed, const Adjacency& adjacency)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL(adjacency.vertex_offsets.size(), GetVertexCount() + 1);
+    DisplaceVertices(random_seed);
+    ComputeGatheredNormals(adjacency);
+}
+
+Asteroid::Mesh::Adjacency Asteroid::Mesh::GetAdjacency() const
+{
+    META_FUNCTION_TASK();
+    const Indices& indices        = GetIndices();
+    const size_t   vertex_count   = GetVertexCount();
+    const size_t   triangle_count = indices.size() / 3;
+
+    Adjacency adjacency;
+    adjacency.vertex_offsets.resize(vertex_count + 1, 0U);
+    for (const Index vertex_index : indices)
+    {
+        adjacency.vertex_offsets[vertex_index + 1]++;
+    }
+    for (size_t vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+    {
+        adjacency.vertex_offsets[vertex_index + 1] += adjacency.vertex_offsets[vertex_index];
+    }
+
+    std::vector<uint32_t> vertex_fill_offsets(adjacency.vertex_offsets.begin(), adjacency.vertex_offsets.end() - 1);
+    adjacency.vertex_triangles.resize(indices.size());
+    for (size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+    {
+        for (size_t corner_index = 0; corner_index < 3; ++corner_index)
+        {
+            const Index vertex_index = indices[triangle_index * 3 + corner_index];
+            adjacency.vertex_triangles[vertex_fill_offsets[vertex_index]++] = static_cast<uint32_t>(triangle_index);
+        }
+    }
+    return adjacency;
+}
+
+void Asteroid::Mesh::DisplaceVertices(uint32_t random_seed)
 {
     META_FUNCTION_TASK();
     const float noise_scale = 0.5F;
@@ -83,22 +148,136 @@ void Asteroid::Mesh::Randomize(uint32_t random_seed)
     const gfx::PerlinNoise perlin_noise(random_persistence(rng), 4, static_cast<int>(random_seed));
 
     auto  random_noise = std::uniform_real_distribution<float>(0.0F, 10000.0F);
-    const float noise = random_noise(rng);
+    const Data::RawVector3F noise_offset(random_noise(rng), random_noise(rng), random_noise(rng));
+
+    const size_t vertex_count = GetVertexCount();
+    std::vector<Data::RawVector3F> noise_positions;
+    noise_positions.reserve(vertex_count);
+    for (size_t vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+    {
+        noise_positions.emplace_back(GetMutableVertex(vertex_index).position * noise_scale);
+    }
+
+    // Evaluate noise for all vertices at once with SIMD generators using 3D seed-offset mode
+    std::vector<float> noise_values(vertex_count);
+    perlin_noise.Evaluate(noise_positions, noise_values, noise_offset);
 
     m_depth_range.first = std::numeric_limits<float>::max();
     m_depth_range.second = std::numeric_limits<float>::min();
 
-    for (size_t vertex_index = 0; vertex_index < GetVertexCount(); ++vertex_index)
+    for (size_t vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
     {
         Vertex& vertex = GetMutableVertex(vertex_index);
-        vertex.position *= perlin_noise(Data::RawVector4F(vertex.position * noise_scale, noise)) * radius_scale + radius_bias;
+        vertex.position *= noise_values[vertex_index] * radius_scale + radius_bias;
 
         const float vertex_depth = vertex.position.GetLength();
         m_depth_range.first = std::min(m_depth_range.first, vertex_depth);
         m_depth_range.second = std::max(m_depth_range.second, vertex_depth);
     }
+}
+
+Asteroid::Mesh::EdgeMidpoints Asteroid::Mesh::GetEdgeMidpoints(const Mesh& next_mesh) const
+{
+    META_FUNCTION_TASK();
+    const size_t vertex_count      = GetVertexCount();
+    const size_t next_vertex_count = next_mesh.GetVertexCount();
+    META_CHECK_TRUE_DESCR(vertex_count < next_vertex_count, "next mesh must be subdivided from this mesh");
+
+    // Midpoint vertex of the edge is connected only to both edge vertices among the vertices of this mesh
+    constexpr Index no_index = std::numeric_limits<Index>::max();
+    EdgeMidpoints   edge_midpoints(next_vertex_count - vertex_count, EdgeMidpoint{ no_index, no_index, no_index });
+    const Indices&  next_indices = next_mesh.GetIndices();
+    for (size_t triangle_offset = 0; triangle_offset < next_indices.size(); triangle_offset += 3)
+    {
+        for (size_t corner_index = 0; corner_index < 3; ++corner_index)
+        {
+            const Index midpoint_index = next_indices[triangle_offset + corner_index];
+            if (midpoint_index < vertex_count)
+                continue;
+
+            EdgeMidpoint& edge_midpoint = edge_midpoints[midpoint_index - vertex_count];
+            edge_midpoint.midpoint_index = midpoint_index;
+            for (const size_t other_corner_index : { (corner_index + 1) % 3, (corner_index + 2) % 3 })
+            {
+                const Index vertex_index = next_indices[triangle_offset + other_corner_index];
+                if (vertex_index >= vertex_count || vertex_index == edge_midpoint.begin_index || vertex_index == edge_midpoint.end_index)
+                    continue;
+
+                META_CHECK_TRUE_DESCR(edge_midpoint.end_index == no_index, "midpoint vertex is connected to more than two vertices of the coarser mesh");
+                (edge_midpoint.begin_index == no_index ? edge_midpoint.begin_index : edge_midpoint.end_index) = vertex_index;
+            }
+        }
+    }
 
-    ComputeAverageNormals();
+    for (const EdgeMidpoint& edge_midpoint : edge_midpoints)
+    {
+        META_CHECK_TRUE_DESCR(edge_midpoint.end_index != no_index, "midpoint vertex is not connected to both edge vertices");
+    }
+    return edge_midpoints;
+}
+
+float Asteroid::Mesh::GetGeometricError(const Mesh& next_mesh, const EdgeMidpoints& edge_midpoints) const
+{
+    META_FUNCTION_TASK();
+    const Vertices& vertices      = GetVertices();
+    const Vertices& next_vertices = next_mesh.GetVertices();
+
+    // Next subdivision mesh has the same displaced surface sampled in edge midpoints,
+    // so the radial deviation of edges from it is the error of approximating the surface with this mesh
+    float geometric_error = 0.F;
+    for (const EdgeMidpoint& edge_midpoint : edge_midpoints)
+    {
+        const gfx::Mesh::Position& begin    = vertices[edge_midpoint.begin_index].position;
+        const gfx::Mesh::Position& end      = vertices[edge_midpoint.end_index].position;
+        const gfx::Mesh::Position& midpoint = next_vertices[edge_midpoint.midpoint_index].position;
+        const auto edge_midpoint_depth = static_cast<float>(hlslpp::length(hlslpp::float3(begin[0] + end[0], begin[1] + end[1], begin[2] + end[2]) / 2.F));
+        geometric_error = std::max(geometric_error, std::abs(midpoint.GetLength() - edge_midpoint_depth));
+    }
+    return geometric_error;
+}
+
+void Asteroid::Mesh::ComputeGatheredNormals(const Adjacency& adjacency)
+{
+    META_FUNCTION_TASK();
+    const Indices& indices        = GetIndices();
+    const size_t   vertex_count   = GetVertexCount();
+    const size_t   triangle_count = indices.size() / 3;
+
+    // Area-weighted face normals are computed independently for each triangle
+    std::vector<hlslpp::float3> face_normals(triangle_count);
+    for (size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+    {
+        const gfx::Mesh::Position& p0 = GetMutableVertex(indices[triangle_index * 3    ]).position;
+        const gfx::Mesh::Position& p1 = GetMutableVertex(indices[triangle_index * 3 + 1]).position;
+        const gfx::Mesh::Position& p2 = GetMutableVertex(indices[triangle_index * 3 + 2]).position;
+        const hlslpp::float3 v0(p0[0], p0[1], p0[2]);
+        const hlslpp::float3 v1(p1[0], p1[1], p1[2]);
+        const hlslpp::float3 v2(p2[0], p2[1], p2[2]);
+        face_normals[triangle_index] = hlslpp::cross(v1 - v0, v2 - v0);
+    }
+
+    // Each vertex normal is gathered from adjacent face normals independently of other vertices,
+    // without scattered accumulation, so vertex ranges can be processed in any order
+    for (size_t vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+    {
+        hlslpp::float3 normal_sum(0.F, 0.F, 0.F);
+        for (uint32_t adjacency_index = adjacency.vertex_offsets[vertex_index]; adjacency_index < adjacency.vertex_offsets[vertex_index + 1]; ++adjacency_index)
+        {
+            normal_sum += face_normals[adjacency.vertex_triangles[adjacency_index]];
+        }
+
+        Vertex& vertex = GetMutableVertex(vertex_index);
+        const hlslpp::float3 position(vertex.position[0], vertex.position[1], vertex.position[2]);
+
+        // Vertices are displaced radially, so the normal is oriented outwards along the position direction
+        if (static_cast<float>(hlslpp::dot(normal_sum, position)) < 0.F)
+        {
+            normal_sum = -normal_sum;
+        }
+
+        const hlslpp::float3 normal = hlslpp::normalize(normal_sum);
+        vertex.normal = gfx::Mesh::Normal(static_cast<float>(normal.x), static_cast<float>(normal.y), static_cast<float>(normal.z));
+    }
 }
 
 Asteroid::Asteroid(const rhi::RenderContext& render_context, const rhi::CommandQueue& render_cmd_queue)
@@ -210,7 +389,7 @@ Asteroid::Colors Asteroid::GetAsteroidIceColors(uint32_t deep_color_index, uint3
 
 Asteroid::Colors Asteroid::GetAsteroidLodColors(uint32_t lod_index)
 {
-    META_FUNCTION_TASK();
+    ASTEROIDS_HOT_FUNCTION_TASK();
     static const AsteroidColorSchema s_srgb_lod_deep_colors{ {
         {  uint8_t(  0), uint8_t(128), uint8_t(  0) }, // LOD-0: green
         {  uint8_t(  0), uint8_t( 64), uint8_t(128) }, // LOD-1: blue
@@ -236,21 +415,72 @@ Asteroid::Colors Asteroid::GetAsteroidLodColors(uint32_t lod_index)
     return Asteroid::Colors{ s_linear_lod_deep_colors[lod_index], s_linear_lod_shallow_colors[lod_index] };
 }
 
-void Asteroid::FillPerlinNoiseToTexture(Data::Bytes& texture_data, const gfx::Dimensions& dimensions, uint32_t row_stride,
-                                        const TextureNoiseParameters& noise_parameters)
+const Asteroid::ColorsPalette& Asteroid::GetColorsPalette()
 {
     META_FUNCTION_TASK();
-    static const auto fractal_noise = [noise_parameters]() {
-        auto noise = FastNoise::New<FastNoise::FractalFBm>();
-        noise->SetSource(FastNoise::New<FastNoise::Simplex>());
-        noise->SetGain(noise_parameters.gain);
-        noise->SetWeightedStrength(noise_parameters.fractal_weight);
-        noise->SetOctaveCount(4);
-        noise->SetLacunarity(noise_parameters.lacunarity);
-        return noise;
+    static const ColorsPalette s_colors_palette = []()
+    {
+        ColorsPalette colors_palette(static_cast<size_t>(ColorsPaletteSchema::Count) * color_schema_size);
+        for (uint32_t color_index = 0U; color_index < color_schema_size; ++color_index)
+        {
+            const Colors rock_colors = GetAsteroidRockColors(color_index, color_index);
+            const Colors ice_colors  = GetAsteroidIceColors(color_index, color_index);
+            const Colors lod_colors  = GetAsteroidLodColors(color_index);
+            colors_palette[GetColorsPaletteIndex(ColorsPaletteSchema::DeepRock,    color_index)] = rock_colors.deep;
+            colors_palette[GetColorsPaletteIndex(ColorsPaletteSchema::ShallowRock, color_index)] = rock_colors.shallow;
+            colors_palette[GetColorsPaletteIndex(ColorsPaletteSchema::DeepIce,     color_index)] = ice_colors.deep;
+            colors_palette[GetColorsPaletteIndex(ColorsPaletteSchema::ShallowIce,  color_index)] = ice_colors.shallow;
+            colors_palette[GetColorsPaletteIndex(ColorsPaletteSchema::DeepLod,     color_index)] = lod_colors.deep;
+            colors_palette[GetColorsPaletteIndex(ColorsPaletteSchema::ShallowLod,  color_index)] = lod_colors.shallow;
+        }
+        return colors_palette;
     }();
+    return s_colors_palette;
+}
+
+Asteroid::ColorIndices Asteroid::GetAsteroidRockColorIndices(uint32_t deep_color_index, uint32_t shallow_color_index)
+{
+    META_FUNCTION_TASK();
+    return ColorIndices{
+        GetColorsPaletteIndex(ColorsPaletteSchema::DeepRock,    deep_color_index),
+        GetColorsPaletteIndex(ColorsPaletteSchema::ShallowRock, shallow_color_index)
+    };
+}
+
+Asteroid::ColorIndices Asteroid::GetAsteroidIceColorIndices(uint32_t deep_color_index, uint32_t shallow_color_index)
+{
+    META_FUNCTION_TASK();
+    return ColorIndices{
+        GetColorsPaletteIndex(ColorsPaletteSchema::DeepIce,    deep_color_index),
+        GetColorsPaletteIndex(ColorsPaletteSchema::ShallowIce, shallow_color_index)
+    };
+}
+
+Asteroid::ColorIndices Asteroid::GetAsteroidLodColorIndices(uint32_t lod_index)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    return ColorIndices{
+        GetColorsPaletteIndex(ColorsPaletteSchema::DeepLod,    lod_index),
+        GetColorsPaletteIndex(ColorsPaletteSchema::ShallowLod, lod_index)
+    };
+}
+
+Asteroid::Colors Asteroid::GetPaletteColors(const ColorIndices& color_indices)
+{
+    META_FUNCTION_TASK();
+    const ColorsPalette& colors_palette = GetColorsPalette();
+    META_CHECK_LESS(color_indices.deep, colors_palette.size());
+    META_CHECK_LESS(color_indices.shallow, colors_palette.size());
+    return Colors{ colors_palette[color_indices.deep], colors_palette[color_indices.shallow] };
+}
 
-    std::vector<float> noise_values(dimensions.GetPixelsCount());
+void Asteroid::FillPerlinNoiseToTexture(Data::Bytes& texture_data, const gfx::Dimensions& dimensions, uint32_t row_stride,
+                                        const TextureNoiseParameters& noise_parameters)
+{
+    META_FUNCTION_TASK();
+    using TexturePerlinNoise = gfx::StaticPerlinNoise<4>;
+    const TexturePerlinNoise perlin_noise(TexturePerlinNoise::GetWeights(noise_parameters.gain),
+                                          noise_parameters.random_seed, noise_parameters.lacunarity);
 
     for (size_t row = 0; row < dimensions.GetHeight(); ++row)
     {
@@ -258,9 +488,8 @@ void Asteroid::FillPerlinNoiseToTexture(Data::Bytes& texture_data, const gfx::Di
         
         for (size_t col = 0; col < dimensions.GetWidth(); ++col)
         {
-            const float noise_intensity = fractal_noise->GenSingle2D(noise_parameters.scale * static_cast<float>(row),
-                                                                     noise_parameters.scale * static_cast<float>(col),
-                                                                     noise_parameters.random_seed);
+            const float noise_intensity = perlin_noise(hlslpp::float2(noise_parameters.scale * static_cast<float>(row),
+                                                                      noise_parameters.scale * static_cast<float>(col)));
 
             auto texel_data = reinterpret_cast<std::byte*>(&row_data[col]); // NOSONAR
             for (size_t channel = 0; channel < 3; ++channel)
@@ -36,6 +36,7 @@ namespace hlslpp // NOSONAR
 }
 
 #include <utility>
+#include <vector>
 
 namespace Methane::Samples
 {
@@ -65,13 +66,44 @@ public:
     public:
         using DepthRange = std::pair<float, float>;
 
+        // Fixed vertex-to-triangles adjacency of the icosahedron mesh in compressed sparse row layout,
+        // which does not change with vertex displacement and is shared by all meshes with the same subdivisions count
+        struct Adjacency
+        {
+            std::vector<uint32_t> vertex_offsets;   // vertex_count + 1 offsets in vertex_triangles
+            std::vector<uint32_t> vertex_triangles; // indices of triangles adjacent to each vertex
+        };
+
+        // Edge of the mesh and its midpoint vertex in the mesh of the next subdivision
+        struct EdgeMidpoint
+        {
+            Index begin_index;
+            Index end_index;
+            Index midpoint_index;
+        };
+
+        using EdgeMidpoints = std::vector<EdgeMidpoint>;
+
         Mesh(uint32_t subdivisions_count, bool randomize);
 
         void Randomize(uint32_t random_seed = 1337);
+        void Randomize(uint32_t random_seed, const Adjacency& adjacency);
 
+        [[nodiscard]] Adjacency GetAdjacency() const;
         [[nodiscard]] const DepthRange& GetDepthRange() const { return m_depth_range; }
 
+        // Edge midpoints are found in the undisplaced mesh of the next subdivision, which keeps vertices of this mesh
+        // and adds one vertex per edge, so they are shared by all meshes with the same subdivisions count
+        [[nodiscard]] EdgeMidpoints GetEdgeMidpoints(const Mesh& next_mesh) const;
+
+        // Maximum radial distance between mesh edges and vertices of the next subdivision mesh at their midpoints, in mesh units,
+        // where the next mesh is displaced with the same random seed
+        [[nodiscard]] float GetGeometricError(const Mesh& next_mesh, const EdgeMidpoints& edge_midpoints) const;
+
     private:
+        void DisplaceVertices(uint32_t random_seed);
+        void ComputeGatheredNormals(const Adjacency& adjacency);
+
         DepthRange m_depth_range;
     };
 
@@ -81,12 +113,22 @@ public:
         gfx::Color3F shallow;
     };
 
+    // Indices of deep and shallow colors in the palette of rock, ice and LOD color schemas
+    struct ColorIndices
+    {
+        uint32_t deep;
+        uint32_t shallow;
+    };
+
+    using ColorsPalette = std::vector<gfx::Color3F>;
+
     struct Parameters
     {
         const uint32_t         index;
         const uint32_t         mesh_instance_index;
         const uint32_t         texture_index;
         const Colors           colors;
+        const ColorIndices     color_indices;
         const hlslpp::float4x4 scale_translate_matrix;
         const hlslpp::float3   spin_axis;
         const float            scale;
@@ -100,7 +142,6 @@ public:
     {
         int   random_seed    = 0;
         float gain           = 0.5F;
-        float fractal_weight = 0.5F;
         float lacunarity     = 2.0F;
         float scale          = 0.5F;
         float strength       = 0.8F;
@@ -121,8 +162,13 @@ public:
     static Colors GetAsteroidRockColors(uint32_t deep_color_index, uint32_t shallow_color_index);
     static Colors GetAsteroidIceColors(uint32_t deep_color_index, uint32_t shallow_color_index);
     static Colors GetAsteroidLodColors(uint32_t lod_index);
-    
-private:
+
+    static const ColorsPalette& GetColorsPalette();
+    static ColorIndices GetAsteroidRockColorIndices(uint32_t deep_color_index, uint32_t shallow_color_index);
+    static ColorIndices GetAsteroidIceColorIndices(uint32_t deep_color_index, uint32_t shallow_color_index);
+    static ColorIndices GetAsteroidLodColorIndices(uint32_t lod_index);
+    static Colors GetPaletteColors(const ColorIndices& color_indices);
+
     static void FillPerlinNoiseToTexture(Data::Bytes& texture_data, const gfx::Dimensions& dimensions, uint32_t row_stride,
                                          const TextureNoiseParameters& noise_parameters);
 };
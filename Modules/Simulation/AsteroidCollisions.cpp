@@ -0,0 +1,236 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidCollisions.cpp
+Parallel spatial hash broad phase and bounding spheres narrow phase
+of asteroid-asteroid collisions detection.
+
+******************************************************************************/
+
+#include "AsteroidCollisions.h"
+#include "ThreadAffinity.h"
+
+#include <Methane/Instrumentation.h>
+#include <HotPathInstrumentation.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+
+namespace Methane::Samples
+{
+
+static constexpr uint32_t g_buckets_per_body      = 2U;
+static constexpr uint32_t g_neighbour_cells_count = 27U; // 3x3x3 block of grid cells around asteroid cell
+
+float AsteroidCollisions::GetBoundingRadius(const Asteroid::Parameters& asteroid_parameters, float mesh_depth_max)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    const hlslpp::float4x4& scale_translate = asteroid_parameters.scale_translate_matrix;
+    const float max_axis_scale = std::max({
+        static_cast<float>(hlslpp::length(hlslpp::float3(scale_translate._m00, scale_translate._m01, scale_translate._m02))),
+        static_cast<float>(hlslpp::length(hlslpp::float3(scale_translate._m10, scale_translate._m11, scale_translate._m12))),
+        static_cast<float>(hlslpp::length(hlslpp::float3(scale_translate._m20, scale_translate._m21, scale_translate._m22)))
+    });
+    return max_axis_scale * mesh_depth_max;
+}
+
+hlslpp::float4 AsteroidCollisions::GetBoundingSphere(const Asteroid::Parameters& asteroid_parameters,
+                                                     const hlslpp::float3& asteroid_position,
+                                                     float mesh_depth_max)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    return hlslpp::float4(asteroid_position, GetBoundingRadius(asteroid_parameters, mesh_depth_max));
+}
+
+const AsteroidCollisions::Events& AsteroidCollisions::Detect(tf::Executor& parallel_executor, const BoundingSpheres& bounding_spheres)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidCollisions::Detect");
+
+    const auto bodies_count = static_cast<uint32_t>(bounding_spheres.size());
+    m_events.clear();
+    m_statistics = Statistics{ .bodies_count = bodies_count };
+    if (bodies_count < 2U)
+        return m_events;
+
+    const uint32_t chunk_size   = ThreadAffinity::GetChunkSize(parallel_executor, bodies_count);
+    const uint32_t chunks_count = (bodies_count + chunk_size - 1U) / chunk_size;
+
+    BuildSpatialHash(parallel_executor, bounding_spheres);
+
+    // Candidate pairs and events buffers are kept per chunk between ticks to avoid allocations in the steady state
+    m_chunk_candidate_pairs.resize(chunks_count);
+    m_chunk_events.resize(chunks_count);
+
+    ThreadAffinity::ForEachIndexRange(parallel_executor, bodies_count,
+        [this, &bounding_spheres, chunk_size](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidCollisions::Detect::Chunk", end_index - begin_index);
+
+            const uint32_t  chunk_index     = begin_index / chunk_size;
+            CandidatePairs& candidate_pairs = m_chunk_candidate_pairs[chunk_index];
+            Events&         chunk_events    = m_chunk_events[chunk_index];
+            candidate_pairs.clear();
+            chunk_events.clear();
+            FindCandidatePairs(begin_index, end_index, candidate_pairs);
+            ProcessNarrowPhase(bounding_spheres, candidate_pairs, chunk_events);
+        }
+    );
+
+    // Chunks cover contiguous ranges of the first asteroid indices, so concatenated events have deterministic order
+    for (uint32_t chunk_index = 0U; chunk_index < chunks_count; ++chunk_index)
+    {
+        const Events& chunk_events = m_chunk_events[chunk_index];
+        m_statistics.candidate_pairs_count += static_cast<uint32_t>(m_chunk_candidate_pairs[chunk_index].size());
+        m_events.insert(m_events.end(), chunk_events.begin(), chunk_events.end());
+    }
+    m_statistics.events_count = static_cast<uint32_t>(m_events.size());
+    return m_events;
+}
+
+uint32_t AsteroidCollisions::GetBucketIndex(const CellCoords& cell_coords) const noexcept
+{
+    // Spatial hash function of grid cell coordinates with large primes from "Optimized Spatial Hashing for Collision Detection"
+    const uint32_t hash = (static_cast<uint32_t>(cell_coords[0]) * 73856093U)
+                        ^ (static_cast<uint32_t>(cell_coords[1]) * 19349663U)
+                        ^ (static_cast<uint32_t>(cell_coords[2]) * 83492791U);
+    return hash & m_buckets_mask;
+}
+
+void AsteroidCollisions::BuildSpatialHash(tf::Executor& parallel_executor, const BoundingSpheres& bounding_spheres)
+{
+    META_FUNCTION_TASK();
+    const auto bodies_count = static_cast<uint32_t>(bounding_spheres.size());
+
+    float max_radius = 0.F;
+    for (const hlslpp::float4& bounding_sphere : bounding_spheres)
+    {
+        max_radius = std::max(max_radius, static_cast<float>(bounding_sphere.w));
+    }
+
+    const uint32_t buckets_count = std::bit_ceil(bodies_count * g_buckets_per_body);
+    m_cell_size                = max_radius > 0.F ? 2.F * max_radius : 1.F;
+    m_buckets_mask             = buckets_count - 1U;
+    m_statistics.cell_size     = m_cell_size;
+    m_statistics.buckets_count = buckets_count;
+    m_body_cells.resize(bodies_count);
+    m_body_buckets.resize(bodies_count);
+
+    ThreadAffinity::ForEachIndexRange(parallel_executor, bodies_count,
+        [this, &bounding_spheres](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidCollisions::BuildSpatialHash::Chunk", end_index - begin_index);
+            for (uint32_t body_index = begin_index; body_index < end_index; ++body_index)
+            {
+                const hlslpp::float4& bounding_sphere = bounding_spheres[body_index];
+                const CellCoords cell_coords{
+                    static_cast<int32_t>(std::floor(static_cast<float>(bounding_sphere.x) / m_cell_size)),
+                    static_cast<int32_t>(std::floor(static_cast<float>(bounding_sphere.y) / m_cell_size)),
+                    static_cast<int32_t>(std::floor(static_cast<float>(bounding_sphere.z) / m_cell_size))
+                };
+                m_body_cells[body_index]   = cell_coords;
+                m_body_buckets[body_index] = GetBucketIndex(cell_coords);
+            }
+        }
+    );
+
+    // Counting sort of body indices by hash bucket keeps ascending body indices inside every bucket
+    m_bucket_offsets.assign(buckets_count + 1U, 0U);
+    for (const uint32_t bucket_index : m_body_buckets)
+    {
+        m_bucket_offsets[bucket_index + 1U]++;
+    }
+    for (uint32_t bucket_index = 0U; bucket_index < buckets_count; ++bucket_index)
+    {
+        m_bucket_offsets[bucket_index + 1U] += m_bucket_offsets[bucket_index];
+    }
+
+    m_bucket_bodies.resize(bodies_count);
+    for (uint32_t body_index = 0U; body_index < bodies_count; ++body_index)
+    {
+        m_bucket_bodies[m_bucket_offsets[m_body_buckets[body_index]]++] = body_index;
+    }
+
+    // Bucket offsets were advanced to the end of every bucket by scattering, so they are shifted back by one bucket
+    for (uint32_t bucket_index = buckets_count; bucket_index > 0U; --bucket_index)
+    {
+        m_bucket_offsets[bucket_index] = m_bucket_offsets[bucket_index - 1U];
+    }
+    m_bucket_offsets[0] = 0U;
+}
+
+void AsteroidCollisions::FindCandidatePairs(uint32_t begin_index, uint32_t end_index, CandidatePairs& candidate_pairs) const
+{
+    std::array<uint32_t, g_neighbour_cells_count> neighbour_buckets{};
+    for (uint32_t body_index = begin_index; body_index < end_index; ++body_index)
+    {
+        const CellCoords& body_cell = m_body_cells[body_index];
+        uint32_t neighbour_buckets_count = 0U;
+        for (int32_t neighbour_index = 0; neighbour_index < static_cast<int32_t>(g_neighbour_cells_count); ++neighbour_index)
+        {
+            // Different neighbour cells may be hashed to the same bucket, which is visited once to avoid duplicate pairs
+            const CellCoords neighbour_cell{
+                body_cell[0] + neighbour_index % 3 - 1,
+                body_cell[1] + neighbour_index / 3 % 3 - 1,
+                body_cell[2] + neighbour_index / 9 - 1
+            };
+            const uint32_t bucket_index          = GetBucketIndex(neighbour_cell);
+            const auto     neighbour_buckets_end = neighbour_buckets.begin() + neighbour_buckets_count;
+            if (std::find(neighbour_buckets.begin(), neighbour_buckets_end, bucket_index) != neighbour_buckets_end)
+                continue;
+
+            neighbour_buckets[neighbour_buckets_count++] = bucket_index;
+            for (uint32_t bucket_body_offset = m_bucket_offsets[bucket_index];
+                 bucket_body_offset < m_bucket_offsets[bucket_index + 1U];
+                 ++bucket_body_offset)
+            {
+                // Every pair is found from the asteroid with smaller index,
+                // while asteroids of distant cells in the same bucket due to hash collisions are skipped
+                const uint32_t    other_body_index = m_bucket_bodies[bucket_body_offset];
+                const CellCoords& other_body_cell  = m_body_cells[other_body_index];
+                if (other_body_index <= body_index ||
+                    std::abs(other_body_cell[0] - body_cell[0]) > 1 ||
+                    std::abs(other_body_cell[1] - body_cell[1]) > 1 ||
+                    std::abs(other_body_cell[2] - body_cell[2]) > 1)
+                    continue;
+
+                candidate_pairs.emplace_back(body_index, other_body_index);
+            }
+        }
+    }
+}
+
+void AsteroidCollisions::ProcessNarrowPhase(const BoundingSpheres& bounding_spheres, const CandidatePairs& candidate_pairs, Events& events)
+{
+    for (const auto& [first_index, second_index] : candidate_pairs)
+    {
+        const hlslpp::float4& first_sphere  = bounding_spheres[first_index];
+        const hlslpp::float4& second_sphere = bounding_spheres[second_index];
+        const hlslpp::float3  centers_offset(second_sphere.xyz - first_sphere.xyz);
+        const float           radii_sum           = static_cast<float>(first_sphere.w + second_sphere.w);
+        const float           centers_distance_sq = static_cast<float>(hlslpp::dot(centers_offset, centers_offset));
+        if (centers_distance_sq >= radii_sum * radii_sum)
+            continue;
+
+        events.push_back(Event{ first_index, second_index, radii_sum - std::sqrt(centers_distance_sq) });
+    }
+}
+
+} // namespace Methane::Samples
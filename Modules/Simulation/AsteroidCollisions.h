@@ -0,0 +1,102 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidCollisions.h
+Parallel spatial hash broad phase and bounding spheres narrow phase
+of asteroid-asteroid collisions detection.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Asteroid.h"
+
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <array>
+#include <utility>
+#include <functional>
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+class AsteroidCollisions
+{
+public:
+    // Bounding sphere of asteroid with center position in xyz and radius in w component
+    using BoundingSpheres = std::vector<hlslpp::float4>;
+
+    struct Event
+    {
+        uint32_t first_index;       // asteroid index, which is always less than the second asteroid index
+        uint32_t second_index;
+        float    penetration_depth; // overlap of bounding spheres along the line of their centers
+    };
+
+    using Events         = std::vector<Event>;
+    using EventsCallback = std::function<void(const Events& events, double elapsed_seconds)>;
+
+    struct Statistics
+    {
+        uint32_t bodies_count          = 0U;
+        uint32_t buckets_count         = 0U;
+        uint32_t candidate_pairs_count = 0U;
+        uint32_t events_count          = 0U;
+        float    cell_size             = 0.F;
+    };
+
+    // Bounding sphere radius is the largest axis scale of asteroid multiplied by the maximum vertex depth of its mesh
+    [[nodiscard]] static float          GetBoundingRadius(const Asteroid::Parameters& asteroid_parameters, float mesh_depth_max);
+    [[nodiscard]] static hlslpp::float4 GetBoundingSphere(const Asteroid::Parameters& asteroid_parameters,
+                                                          const hlslpp::float3& asteroid_position,
+                                                          float mesh_depth_max);
+
+    // Broad phase hashes asteroids to uniform grid cells with size of the largest bounding sphere diameter,
+    // so every overlapping pair is found among asteroids of the 27 neighbour cells with O(n) expected cost;
+    // candidate pairs of each worker chunk are passed to the narrow phase, which reports overlapping bounding spheres
+    const Events& Detect(tf::Executor& parallel_executor, const BoundingSpheres& bounding_spheres);
+
+    [[nodiscard]] const Events&     GetEvents() const noexcept     { return m_events; }
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+private:
+    using CellCoords     = std::array<int32_t, 3>;
+    using CandidatePair  = std::pair<uint32_t, uint32_t>;
+    using CandidatePairs = std::vector<CandidatePair>;
+
+    [[nodiscard]] uint32_t GetBucketIndex(const CellCoords& cell_coords) const noexcept;
+
+    void BuildSpatialHash(tf::Executor& parallel_executor, const BoundingSpheres& bounding_spheres);
+    void FindCandidatePairs(uint32_t begin_index, uint32_t end_index, CandidatePairs& candidate_pairs) const;
+    static void ProcessNarrowPhase(const BoundingSpheres& bounding_spheres, const CandidatePairs& candidate_pairs, Events& events);
+
+    float                       m_cell_size    = 0.F;
+    uint32_t                    m_buckets_mask = 0U;
+    std::vector<CellCoords>     m_body_cells;
+    std::vector<uint32_t>       m_body_buckets;
+    std::vector<uint32_t>       m_bucket_offsets; // buckets_count + 1 offsets of bodies in m_bucket_bodies
+    std::vector<uint32_t>       m_bucket_bodies;  // body indices sorted by hash bucket
+    std::vector<CandidatePairs> m_chunk_candidate_pairs;
+    std::vector<Events>         m_chunk_events;
+    Events                      m_events;
+    Statistics                  m_statistics;
+};
+
+} // namespace Methane::Samples
@@ -32,15 +32,46 @@ Random generated asteroids array with uber mesh and textures ready for rendering
 #include <Methane/Data/AppResourceProviders.h>
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
+#include <HotPathInstrumentation.h>
 
 #include <taskflow/algorithm/for_each.hpp>
 #include <future>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <algorithm>
+#include <limits>
 #include <cmath>
 #include <numbers>
+#include <numeric>
 
 namespace Methane::Samples
 {
 
+constexpr uint32_t g_coarse_texture_size = 64U;
+
+// Balanced parallel drawing cost model and adaptation parameters:
+// draw cost is estimated in units of one draw call encoding, mesh indices add GPU cost in proportion to the indices count
+constexpr float    g_draw_indices_per_cost_unit   = 2048.F;
+constexpr double   g_draw_chunk_target_seconds    = 0.0001;
+constexpr double   g_cmd_list_min_encode_seconds  = 0.0005;
+constexpr double   g_encode_seconds_ema_factor    = 0.1;
+constexpr uint32_t g_max_draw_chunks_per_cmd_list = 16U;
+
+// Triangle budget controller of mesh LODs screen error: deviations from budget within tolerance are ignored
+// and screen error is changed by limited ratio on each simulation step, so that mesh LODs do not oscillate
+constexpr float    g_mesh_lod_budget_tolerance    = 0.05F;
+constexpr float    g_mesh_lod_max_error_ratio     = 1.25F;
+constexpr float    g_mesh_lod_min_screen_error    = 0.1F;
+constexpr float    g_mesh_lod_max_screen_error    = 256.F;
+
+// Batch position of asteroid, which is not drawn with the current drawn fraction
+constexpr uint32_t g_hidden_batch_position        = std::numeric_limits<uint32_t>::max();
+
+// Histogram of draw priorities with logarithmic bins covers priorities from 2^-32 to 2^32 with 1/16 octave precision
+constexpr uint32_t g_draw_priority_bins_per_octave = 16U;
+constexpr uint32_t g_draw_priority_bins_count      = g_draw_priority_bins_per_octave * 64U;
+
 static hlslpp::float3 GetRandomDirection(std::mt19937& rng)
 {
     META_FUNCTION_TASK();
@@ -54,7 +85,266 @@ static hlslpp::float3 GetRandomDirection(std::mt19937& rng)
     return hlslpp::normalize(direction);
 }
 
-AsteroidsArray::UberMesh::UberMesh(tf::Executor& parallel_executor, uint32_t instance_count, uint32_t subdivisions_count, uint32_t random_seed)
+// Orbit angle of the position in the same convention as used for asteroid orbit rotation around Y axis
+static float GetOrbitAngle(const hlslpp::float3& position)
+{
+    META_FUNCTION_TASK();
+    const hlslpp::float4 zero_angle_dir    = hlslpp::mul(hlslpp::float4(1.F, 0.F, 0.F, 0.F), hlslpp::float4x4::rotation_y(0.F));
+    const hlslpp::float4 right_angle_dir   = hlslpp::mul(hlslpp::float4(1.F, 0.F, 0.F, 0.F), hlslpp::float4x4::rotation_y(static_cast<float>(std::numbers::pi) / 2.F));
+    const float          orbit_angle_rad   = std::atan2(static_cast<float>(hlslpp::dot(position, hlslpp::float3(right_angle_dir.xyz))),
+                                                        static_cast<float>(hlslpp::dot(position, hlslpp::float3(zero_angle_dir.xyz))));
+    return orbit_angle_rad < 0.F ? orbit_angle_rad + 2.F * static_cast<float>(std::numbers::pi) : orbit_angle_rad;
+}
+
+static_assert(sizeof(hlslpp::AsteroidInstanceUniforms) == 64U, "Compact asteroid instance uniforms size is expected to be 64 bytes");
+
+// Model matrix is stored transposed in uniforms, so its rows are columns of the model matrix
+// and the last row with constant (0, 0, 0, 1) values is dropped
+static void SetInstanceModelMatrix(hlslpp::AsteroidInstanceUniforms& instance_uniforms, const hlslpp::float4x4& transposed_model_matrix)
+{
+    const hlslpp::float4x4& m = transposed_model_matrix;
+    instance_uniforms.model_matrix_x = hlslpp::float4(m._m00, m._m01, m._m02, m._m03);
+    instance_uniforms.model_matrix_y = hlslpp::float4(m._m10, m._m11, m._m12, m._m13);
+    instance_uniforms.model_matrix_z = hlslpp::float4(m._m20, m._m21, m._m22, m._m23);
+}
+
+static hlslpp::AsteroidInstanceUniforms GetAsteroidInstanceUniforms(const AsteroidsArray::AsteroidUpdate& asteroid_update)
+{
+    const hlslpp::AsteroidUniforms& uniforms = asteroid_update.uniforms;
+    hlslpp::AsteroidInstanceUniforms instance_uniforms
+    {
+        .depth_min     = uniforms.depth_min,
+        .depth_max     = uniforms.depth_max,
+        .color_indices = asteroid_update.color_indices.deep | (asteroid_update.color_indices.shallow << 16U),
+        .texture_index = uniforms.texture_index
+    };
+    SetInstanceModelMatrix(instance_uniforms, uniforms.model_matrix);
+    return instance_uniforms;
+}
+
+static_assert(sizeof(hlslpp::AsteroidMotionUniforms) == 80U, "Asteroid motion uniforms size is expected to be 80 bytes");
+
+static hlslpp::AsteroidMotionUniforms GetAsteroidMotionUniforms(const Asteroid::Parameters& asteroid_parameters)
+{
+    META_FUNCTION_TASK();
+
+    // Model matrix at zero time is spin_rotation(spin_angle) * scale_translate * orbit_rotation(orbit_angle),
+    // so the model matrix at any time is spin_rotation(spin_speed * t) * init_model_matrix * orbit_rotation(-orbit_speed * t)
+    const hlslpp::float4x4 init_model_matrix = hlslpp::mul(
+        hlslpp::mul(hlslpp::float4x4::rotation_axis(asteroid_parameters.spin_axis, asteroid_parameters.spin_angle_rad),
+                    asteroid_parameters.scale_translate_matrix),
+        hlslpp::float4x4::rotation_y(asteroid_parameters.orbit_angle_rad));
+
+    hlslpp::AsteroidMotionUniforms motion_uniforms
+    {
+        .angular_velocity = hlslpp::float4(asteroid_parameters.spin_axis * asteroid_parameters.spin_speed, -asteroid_parameters.orbit_speed),
+        .color_indices    = asteroid_parameters.color_indices.deep | (asteroid_parameters.color_indices.shallow << 16U),
+        .texture_index    = asteroid_parameters.texture_index
+    };
+    const hlslpp::float4x4 m = hlslpp::transpose(init_model_matrix);
+    motion_uniforms.model_matrix_x = hlslpp::float4(m._m00, m._m01, m._m02, m._m03);
+    motion_uniforms.model_matrix_y = hlslpp::float4(m._m10, m._m11, m._m12, m._m13);
+    motion_uniforms.model_matrix_z = hlslpp::float4(m._m20, m._m21, m._m22, m._m23);
+    return motion_uniforms;
+}
+
+// Mesh LOD subdivision is the coarsest one, which geometric error projected to screen from the given position does not exceed screen error
+static uint32_t GetMeshSubdivisionIndex(const Asteroid::Parameters& asteroid_parameters, const AsteroidsArray::UberMesh& uber_mesh,
+                                        const hlslpp::float3& asteroid_position, const hlslpp::float3& eye_position,
+                                        float mesh_lod_error_scale)
+{
+    const float    distance_to_eye          = hlslpp::length(eye_position - asteroid_position);
+    const float    max_geometric_error      = distance_to_eye / (asteroid_parameters.scale * mesh_lod_error_scale);
+    const uint32_t finest_subdivision_index = uber_mesh.GetSubdivisionsCount() - 1;
+    for (uint32_t subdivision_index = 0U; subdivision_index < finest_subdivision_index; ++subdivision_index)
+    {
+        const uint32_t mesh_subset_index = uber_mesh.GetSubsetIndex(asteroid_parameters.mesh_instance_index, subdivision_index);
+        if (uber_mesh.GetSubsetGeometricError(mesh_subset_index) <= max_geometric_error)
+            return subdivision_index;
+    }
+    return finest_subdivision_index;
+}
+
+// Model matrix of asteroid spinning around its axis and moving on unperturbed orbit at the given time
+static hlslpp::float4x4 GetAsteroidOrbitModelMatrix(const Asteroid::Parameters& asteroid_parameters, float elapsed_radians)
+{
+    const float spin_angle_rad  = asteroid_parameters.spin_angle_rad  + asteroid_parameters.spin_speed  * elapsed_radians;
+    const float orbit_angle_rad = asteroid_parameters.orbit_angle_rad - asteroid_parameters.orbit_speed * elapsed_radians;
+
+    const hlslpp::float4x4 spin_rotation_matrix  = hlslpp::float4x4::rotation_axis(asteroid_parameters.spin_axis, spin_angle_rad);
+    const hlslpp::float4x4 orbit_rotation_matrix = hlslpp::float4x4::rotation_y(orbit_angle_rad);
+    return hlslpp::mul(hlslpp::mul(spin_rotation_matrix, asteroid_parameters.scale_translate_matrix), orbit_rotation_matrix);
+}
+
+// Asteroid keeps spin and orbit orientation, while its translation is offset from the orbit position to the perturbed position
+static hlslpp::float4x4 GetAsteroidPerturbedModelMatrix(const Asteroid::Parameters& asteroid_parameters, float elapsed_radians,
+                                                        const hlslpp::float3& asteroid_position)
+{
+    const hlslpp::float4x4 orbit_model_matrix = GetAsteroidOrbitModelMatrix(asteroid_parameters, elapsed_radians);
+    const hlslpp::float3   orbit_position(orbit_model_matrix._m30, orbit_model_matrix._m31, orbit_model_matrix._m32);
+    return hlslpp::mul(orbit_model_matrix, hlslpp::float4x4::translation(asteroid_position - orbit_position));
+}
+
+// Model matrix interpolated between poses of simulation ticks: position is interpolated linearly and rotations with normalized
+// quaternions, while non-uniform scale is applied between spin and orbit rotations as in the orbit model matrix
+static hlslpp::float4x4 GetAsteroidInterpolatedModelMatrix(const hlslpp::float3& scale,
+                                                           const hlslpp::quaternion& spin_rotation, const hlslpp::quaternion& next_spin_rotation,
+                                                           const hlslpp::quaternion& orbit_rotation, const hlslpp::quaternion& next_orbit_rotation,
+                                                           const hlslpp::float3& position, const hlslpp::float3& next_position,
+                                                           float tick_ratio)
+{
+    const hlslpp::float3x3 spin_matrix(hlslpp::nlerp(spin_rotation, next_spin_rotation, tick_ratio));
+    const hlslpp::float3x3 orbit_matrix(hlslpp::nlerp(orbit_rotation, next_orbit_rotation, tick_ratio));
+    const hlslpp::float3x3 m = hlslpp::mul(hlslpp::mul(spin_matrix, hlslpp::float3x3::scale(scale)), orbit_matrix);
+    return hlslpp::float4x4(hlslpp::float4(m._m00, m._m01, m._m02, 0.F),
+                            hlslpp::float4(m._m10, m._m11, m._m12, 0.F),
+                            hlslpp::float4(m._m20, m._m21, m._m22, 0.F),
+                            hlslpp::float4(hlslpp::lerp(position, next_position, tick_ratio), 1.F));
+}
+
+// Mesh LOD subset and uniforms of asteroid with the given model matrix
+static AsteroidsArray::AsteroidUpdate ComputeAsteroidModelUpdate(const Asteroid::Parameters& asteroid_parameters,
+                                                                 const AsteroidsArray::UberMesh& uber_mesh,
+                                                                 const hlslpp::float4x4& model_matrix,
+                                                                 const hlslpp::float3& eye_position,
+                                                                 float mesh_lod_error_scale,
+                                                                 bool mesh_lod_coloring_enabled)
+{
+    const hlslpp::float3 asteroid_position(model_matrix._m30, model_matrix._m31, model_matrix._m32);
+
+    const uint32_t mesh_subdivision_index   = GetMeshSubdivisionIndex(asteroid_parameters, uber_mesh, asteroid_position, eye_position,
+                                                                      mesh_lod_error_scale);
+    const uint32_t mesh_subset_index        = uber_mesh.GetSubsetIndex(asteroid_parameters.mesh_instance_index, mesh_subdivision_index);
+    const auto&   [mesh_depth_min, mesh_depth_max] = uber_mesh.GetSubsetDepthRange(mesh_subset_index);
+    const Asteroid::Colors& asteroid_colors = mesh_lod_coloring_enabled
+                                            ? Asteroid::GetAsteroidLodColors(mesh_subdivision_index)
+                                            : asteroid_parameters.colors;
+    const Asteroid::ColorIndices asteroid_color_indices = mesh_lod_coloring_enabled
+                                                        ? Asteroid::GetAsteroidLodColorIndices(mesh_subdivision_index)
+                                                        : asteroid_parameters.color_indices;
+
+    return AsteroidsArray::AsteroidUpdate
+    {
+        .uniforms = hlslpp::AsteroidUniforms
+        {
+            .model_matrix  = hlslpp::transpose(model_matrix),
+            .deep_color    = asteroid_colors.deep.AsVector(),
+            .shallow_color = asteroid_colors.shallow.AsVector(),
+            .depth_min     = mesh_depth_min,
+            .depth_max     = mesh_depth_max,
+            .texture_index = asteroid_parameters.texture_index
+        },
+        .color_indices     = asteroid_color_indices,
+        .mesh_subset_index = mesh_subset_index
+    };
+}
+
+static rhi::BufferSettings GetStructuredBufferSettings(Data::Size item_size, uint32_t items_count)
+{
+    return rhi::BufferSettings
+    {
+        .type             = rhi::BufferType::ReadOnly,
+        .usage_mask       = rhi::ResourceUsageMask(rhi::ResourceUsage::ShaderRead),
+        .size             = item_size * items_count,
+        .item_stride_size = item_size,
+        .data_format      = gfx::PixelFormat::Unknown,
+        .storage_mode     = rhi::BufferStorageMode::Managed
+    };
+}
+
+class AsteroidParametersGenerator
+{
+public:
+    struct OrbitSector
+    {
+        float angle_begin_rad;
+        float angle_size_rad;
+        float elapsed_radians;
+    };
+
+    explicit AsteroidParametersGenerator(const AsteroidsArray::Settings& settings)
+        : m_settings(settings)
+        , m_mesh_distribution(0U, settings.unique_mesh_count - 1)
+        , m_colors_distribution(0, static_cast<uint32_t>(Asteroid::color_schema_size - 1))
+        , m_scale_distribution(settings.min_asteroid_scale_ratio, settings.max_asteroid_scale_ratio)
+        , m_orbit_radius_distribution(settings.orbit_radius_ratio * settings.scale, 0.6F * settings.disc_radius_ratio * settings.scale)
+        , m_orbit_height_distribution(0.0F, 0.4F * settings.disc_radius_ratio * settings.scale)
+    { }
+
+    [[nodiscard]] Asteroid::Parameters Generate(std::mt19937& rng, std::uniform_int_distribution<uint32_t>& textures_distribution,
+                                                uint32_t asteroid_index, const OrbitSector* orbit_sector_ptr = nullptr)
+    {
+        META_FUNCTION_TASK();
+        const uint32_t       asteroid_mesh_index   = m_mesh_distribution(rng);
+        const float          asteroid_orbit_radius = m_orbit_radius_distribution(rng);
+        const float          asteroid_orbit_height = m_orbit_height_distribution(rng);
+        const float          asteroid_scale_ratio  = m_scale_distribution(rng);
+        const float          asteroid_scale        = asteroid_scale_ratio * m_settings.scale;
+        const hlslpp::float3 asteroid_scale_ratios = hlslpp::float3(m_scale_proportion_distribution(rng),
+                                                                    m_scale_proportion_distribution(rng),
+                                                                    m_scale_proportion_distribution(rng)) * asteroid_scale_ratio;
+
+        hlslpp::float4x4 scale_translate_matrix = hlslpp::mul(
+            hlslpp::float4x4::scale(asteroid_scale_ratios * m_settings.scale),
+            hlslpp::float4x4::translation(asteroid_orbit_radius, asteroid_orbit_height, 0.F)
+        );
+        const Asteroid::ColorIndices asteroid_color_indices = m_normal_distribution(rng) <= 1.F
+                                                            ? Asteroid::GetAsteroidIceColorIndices(m_colors_distribution(rng), m_colors_distribution(rng))
+                                                            : Asteroid::GetAsteroidRockColorIndices(m_colors_distribution(rng), m_colors_distribution(rng));
+
+        const uint32_t       asteroid_texture_index = m_settings.textures_array_enabled ? textures_distribution(rng) : 0U;
+        const hlslpp::float3 asteroid_spin_axis     = GetRandomDirection(rng);
+        const float          asteroid_orbit_speed   = m_orbit_velocity_distribution(rng) / (asteroid_scale * asteroid_orbit_radius);
+        const float          asteroid_spin_speed    = m_spin_velocity_distribution(rng)  / asteroid_scale;
+        const float          asteroid_spin_angle    = static_cast<float>(std::numbers::pi) * m_normal_distribution(rng);
+        float                asteroid_orbit_angle   = static_cast<float>(std::numbers::pi) * m_normal_distribution(rng) * 2.F;
+        if (orbit_sector_ptr)
+        {
+            // Asteroid is placed inside the orbit sector at the time of generation
+            std::uniform_real_distribution<float> sector_angle_distribution(0.F, orbit_sector_ptr->angle_size_rad);
+            asteroid_orbit_angle = orbit_sector_ptr->angle_begin_rad + sector_angle_distribution(rng)
+                                 + asteroid_orbit_speed * orbit_sector_ptr->elapsed_radians;
+        }
+
+        return Asteroid::Parameters
+        {
+            .index                  = asteroid_index,
+            .mesh_instance_index    = asteroid_mesh_index,
+            .texture_index          = asteroid_texture_index,
+            .colors                 = Asteroid::GetPaletteColors(asteroid_color_indices),
+            .color_indices          = asteroid_color_indices,
+            .scale_translate_matrix = std::move(scale_translate_matrix),
+            .spin_axis              = asteroid_spin_axis,
+            .scale                  = asteroid_scale,
+            .orbit_speed            = asteroid_orbit_speed,
+            .spin_speed             = asteroid_spin_speed,
+            .spin_angle_rad         = asteroid_spin_angle,
+            .orbit_angle_rad        = asteroid_orbit_angle
+        };
+    }
+
+private:
+    const AsteroidsArray::Settings&         m_settings;
+    std::normal_distribution<float>         m_normal_distribution;
+    std::uniform_int_distribution<uint32_t> m_mesh_distribution;
+    std::uniform_int_distribution<uint32_t> m_colors_distribution;
+    std::uniform_real_distribution<float>   m_scale_distribution;
+    std::uniform_real_distribution<float>   m_scale_proportion_distribution{ 0.8F, 1.2F };
+    std::uniform_real_distribution<float>   m_spin_velocity_distribution{ -1.7F, 1.7F };
+    std::uniform_real_distribution<float>   m_orbit_velocity_distribution{ 1.5F, 5.F };
+    std::normal_distribution<float>         m_orbit_radius_distribution;
+    std::normal_distribution<float>         m_orbit_height_distribution;
+};
+
+float AsteroidsArray::ContentProgress::GetRatio() const noexcept
+{
+    return m_steps_count
+         ? std::min(1.F, static_cast<float>(m_completed_steps_count.load()) / static_cast<float>(m_steps_count))
+         : 1.F;
+}
+
+AsteroidsArray::UberMesh::UberMesh(tf::Executor& parallel_executor, uint32_t instance_count, uint32_t subdivisions_count, uint32_t random_seed,
+                                   ContentProgress* progress_ptr)
     : gfx::UberMesh<Asteroid::Vertex>(Asteroid::Vertex::layout)
     , m_instance_count(instance_count)
     , m_subdivisions_count(subdivisions_count)
@@ -63,34 +353,80 @@ AsteroidsArray::UberMesh::UberMesh(tf::Executor& parallel_executor, uint32_t ins
     META_SCOPE_TIMER("AsteroidsArray::UberMesh::UberMesh");
 
     m_depth_ranges.reserve(static_cast<size_t>(m_instance_count) * m_subdivisions_count);
+    m_geometric_errors.reserve(static_cast<size_t>(m_instance_count) * m_subdivisions_count);
 
+    // Every mesh instance is displaced with the same random seed in all subdivisions, so that finer subdivisions refine the same shape
     std::mt19937 rng(random_seed); // NOSONAR - using pseudorandom generator is safe here
-    TracyLockable(std::mutex, data_mutex);
-
+    std::vector<uint32_t> instance_random_seeds(m_instance_count);
+    std::generate(instance_random_seeds.begin(), instance_random_seeds.end(), std::ref(rng));
+
+    // Meshes of the previous subdivision are added when the next subdivision is generated,
+    // because their geometric errors are measured by the next subdivision vertices in edge midpoints
+    std::optional<Asteroid::Mesh> prev_base_mesh;
+    std::vector<Asteroid::Mesh>   prev_meshes;
+    GeometricErrors               prev_geometric_errors;
     for (uint32_t subdivision_index = 0; subdivision_index < m_subdivisions_count; ++subdivision_index)
     {
+        if (progress_ptr && progress_ptr->IsCancelled())
+            return;
+
         Asteroid::Mesh base_mesh(subdivision_index, false);
         base_mesh.Spherify();
 
+        // Mesh topology is the same for all asteroids of one subdivision, so adjacency is computed once for normals gathering
+        const Asteroid::Mesh::Adjacency     base_mesh_adjacency = base_mesh.GetAdjacency();
+        const Asteroid::Mesh::EdgeMidpoints prev_edge_midpoints = prev_base_mesh
+                                                                ? prev_base_mesh->GetEdgeMidpoints(base_mesh)
+                                                                : Asteroid::Mesh::EdgeMidpoints();
+        std::vector<Asteroid::Mesh> meshes(m_instance_count, base_mesh);
+        prev_geometric_errors.resize(prev_meshes.size());
+
         tf::Taskflow task_flow;
         task_flow.for_each_index(0U, m_instance_count, 1U,
-            [this, &rng, &data_mutex, &base_mesh](const uint32_t)
+            [&meshes, &instance_random_seeds, &base_mesh_adjacency, &prev_meshes, &prev_edge_midpoints, &prev_geometric_errors, progress_ptr]
+            (const uint32_t instance_index)
             {
-                Asteroid::Mesh asteroid_mesh(base_mesh);
-                asteroid_mesh.Randomize(rng()); // NOSONAR
+                if (progress_ptr && progress_ptr->IsCancelled())
+                    return;
+
+                Asteroid::Mesh& asteroid_mesh = meshes[instance_index];
+                asteroid_mesh.Randomize(instance_random_seeds[instance_index], base_mesh_adjacency);
+                if (!prev_meshes.empty())
+                    prev_geometric_errors[instance_index] = prev_meshes[instance_index].GetGeometricError(asteroid_mesh, prev_edge_midpoints);
 
-                std::scoped_lock lock_guard(data_mutex);
-                m_depth_ranges.emplace_back(asteroid_mesh.GetDepthRange());
-                AddSubMesh(asteroid_mesh, false);
+                if (progress_ptr)
+                    progress_ptr->CompleteSteps();
             }
         );
         parallel_executor.run(task_flow).get();
+        if (progress_ptr && progress_ptr->IsCancelled())
+            return;
+
+        AddSubdivisionMeshes(prev_meshes, prev_geometric_errors);
+        prev_base_mesh = std::move(base_mesh);
+        prev_meshes    = std::move(meshes);
     }
+
+    // The finest subdivision has no geometric error estimate, since it is selected when coarser subdivisions errors are too large
+    prev_geometric_errors.assign(prev_meshes.size(), 0.F);
+    AddSubdivisionMeshes(prev_meshes, prev_geometric_errors);
 }
 
-uint32_t AsteroidsArray::UberMesh::GetSubsetIndex(uint32_t instance_index, uint32_t subdivision_index) const
+void AsteroidsArray::UberMesh::AddSubdivisionMeshes(const std::vector<Asteroid::Mesh>& meshes, const GeometricErrors& geometric_errors)
 {
     META_FUNCTION_TASK();
+    META_CHECK_EQUAL(meshes.size(), geometric_errors.size());
+    for (size_t instance_index = 0; instance_index < meshes.size(); ++instance_index)
+    {
+        m_depth_ranges.emplace_back(meshes[instance_index].GetDepthRange());
+        m_geometric_errors.emplace_back(geometric_errors[instance_index]);
+        AddSubMesh(meshes[instance_index], false);
+    }
+}
+
+uint32_t AsteroidsArray::UberMesh::GetSubsetIndex(uint32_t instance_index, uint32_t subdivision_index) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
     META_CHECK_LESS(instance_index, m_instance_count);
     META_CHECK_LESS(subdivision_index, m_subdivisions_count);
 
@@ -99,7 +435,7 @@ uint32_t AsteroidsArray::UberMesh::GetSubsetIndex(uint32_t instance_index, uint3
 
 uint32_t AsteroidsArray::UberMesh::GetSubsetSubdivision(uint32_t subset_index) const
 {
-    META_FUNCTION_TASK();
+    ASTEROIDS_HOT_FUNCTION_TASK();
     META_CHECK_LESS(subset_index, GetSubsetCount());
 
     const uint32_t subdivision_index = subset_index / m_instance_count;
@@ -110,23 +446,153 @@ uint32_t AsteroidsArray::UberMesh::GetSubsetSubdivision(uint32_t subset_index) c
 
 const Asteroid::Mesh::DepthRange& AsteroidsArray::UberMesh::GetSubsetDepthRange(uint32_t subset_index) const
 {
-    META_FUNCTION_TASK();
+    ASTEROIDS_HOT_FUNCTION_TASK();
     META_CHECK_LESS(subset_index, GetSubsetCount());
     assert(subset_index < m_depth_ranges.size());
     return m_depth_ranges[subset_index];
 }
 
-AsteroidsArray::ContentState::ContentState(tf::Executor& parallel_executor, const Settings& settings)
-    : uber_mesh(parallel_executor, settings.unique_mesh_count, settings.subdivisions_count, settings.random_seed)
+float AsteroidsArray::UberMesh::GetSubsetGeometricError(uint32_t subset_index) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    META_CHECK_LESS(subset_index, GetSubsetCount());
+    assert(subset_index < m_geometric_errors.size());
+    return m_geometric_errors[subset_index];
+}
+
+uint32_t AsteroidsArray::UberMesh::GetSubsetTrianglesCount(uint32_t subset_index) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    META_CHECK_LESS(subset_index, GetSubsetCount());
+    return static_cast<uint32_t>(GetSubsets()[subset_index].indices.count / 3);
+}
+
+AsteroidsArray::ContentState::ContentState(tf::Executor& parallel_executor, const Settings& settings,
+                                           ContentProgress* progress_ptr)
+    : uber_mesh(parallel_executor, settings.unique_mesh_count, settings.subdivisions_count, settings.random_seed, progress_ptr)
 {
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsArray::ContentState::ContentState");
 
     std::mt19937 rng(settings.random_seed); // NOSONAR - using pseudorandom generator is safe here
+    GenerateTextures(parallel_executor, settings, rng, progress_ptr);
+    GenerateMeshSubsetTextureIndices(settings, rng);
+    if (progress_ptr && progress_ptr->IsCancelled())
+        return;
+
+    if (IsBeltStreamingEnabled(settings))
+    {
+        // Only belt pages near the view camera are generated in streaming belt mode
+        UpdateBeltPages(settings, 0.F);
+        if (progress_ptr)
+            progress_ptr->CompleteSteps();
+        return;
+    }
+
+    // Randomly generate parameters of each asteroid in array
+    ResizeParameters(settings, rng, progress_ptr);
+}
+
+AsteroidsArray::ContentState::ContentState(tf::Executor& parallel_executor, const Settings& settings,
+                                           const ContentState& prev_state, const Settings& prev_settings,
+                                           ContentProgress* progress_ptr)
+    : uber_mesh(IsUberMeshReusable(prev_settings, settings)
+                ? prev_state.uber_mesh
+                : UberMesh(parallel_executor, settings.unique_mesh_count, settings.subdivisions_count, settings.random_seed, progress_ptr))
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::ContentState::ContentState(incremental)");
+
+    std::mt19937 rng(settings.random_seed ^ settings.instance_count); // NOSONAR - using pseudorandom generator is safe here
+
+    const bool textures_reused = AreTexturesReusable(prev_settings, settings);
+    if (textures_reused)
+        texture_array_subresources = prev_state.texture_array_subresources;
+    else
+        GenerateTextures(parallel_executor, settings, rng, progress_ptr);
+
+    if (textures_reused && IsUberMeshReusable(prev_settings, settings))
+        mesh_subset_texture_indices = prev_state.mesh_subset_texture_indices;
+    else
+        GenerateMeshSubsetTextureIndices(settings, rng);
+
+    if (progress_ptr && progress_ptr->IsCancelled())
+        return;
+
+    if (IsBeltStreamingEnabled(settings))
+    {
+        // Pages are placed at their orbital phase at the last simulated time of the previous state
+        UpdateBeltPages(settings, prev_state.simulated_elapsed_radians);
+        if (progress_ptr)
+            progress_ptr->CompleteSteps();
+        return;
+    }
+
+    if (!IsBeltStreamingEnabled(prev_settings))
+    {
+        // Asteroids of the previous state keep their orbits, while mesh indices are wrapped to the new range
+        // and texture indices are redistributed between the new textures, unless textures are reused
+        // Parameters are copied, since their fields are constant
+        std::uniform_int_distribution<uint32_t> textures_distribution(0U, settings.textures_count - 1);
+        const size_t kept_parameters_count = std::min(prev_state.parameters.size(), static_cast<size_t>(settings.instance_count));
+        parameters.reserve(settings.instance_count);
+        for (size_t asteroid_index = 0; asteroid_index < kept_parameters_count; ++asteroid_index)
+        {
+            const Asteroid::Parameters& prev_parameters = prev_state.parameters[asteroid_index];
+            const uint32_t texture_index = !settings.textures_array_enabled ? 0U
+                                         : textures_reused                  ? prev_parameters.texture_index
+                                                                            : textures_distribution(rng);
+            parameters.emplace_back(Asteroid::Parameters
+            {
+                .index                  = prev_parameters.index,
+                .mesh_instance_index    = prev_parameters.mesh_instance_index % settings.unique_mesh_count,
+                .texture_index          = texture_index,
+                .colors                 = prev_parameters.colors,
+                .color_indices          = prev_parameters.color_indices,
+                .scale_translate_matrix = prev_parameters.scale_translate_matrix,
+                .spin_axis              = prev_parameters.spin_axis,
+                .scale                  = prev_parameters.scale,
+                .orbit_speed            = prev_parameters.orbit_speed,
+                .spin_speed             = prev_parameters.spin_speed,
+                .spin_angle_rad         = prev_parameters.spin_angle_rad,
+                .orbit_angle_rad        = prev_parameters.orbit_angle_rad
+            });
+        }
+    }
+    ResizeParameters(settings, rng, progress_ptr);
+}
+
+uint32_t AsteroidsArray::ContentState::GetGenerationStepsCount(const Settings& settings, const Settings* prev_settings_ptr) noexcept
+{
+    // Every generated mesh subset and texture is a separate step, plus one step for asteroid parameters
+    const bool     uber_mesh_reused    = prev_settings_ptr && IsUberMeshReusable(*prev_settings_ptr, settings);
+    const bool     textures_reused     = prev_settings_ptr && AreTexturesReusable(*prev_settings_ptr, settings);
+    const uint32_t mesh_steps_count    = uber_mesh_reused ? 0U : settings.unique_mesh_count * settings.subdivisions_count;
+    const uint32_t texture_steps_count = textures_reused  ? 0U : settings.textures_count;
+    return mesh_steps_count + texture_steps_count + 1U;
+}
+
+bool AsteroidsArray::ContentState::IsUberMeshReusable(const Settings& prev_settings, const Settings& settings) noexcept
+{
+    return prev_settings.unique_mesh_count  == settings.unique_mesh_count
+        && prev_settings.subdivisions_count == settings.subdivisions_count
+        && prev_settings.random_seed        == settings.random_seed;
+}
+
+bool AsteroidsArray::ContentState::AreTexturesReusable(const Settings& prev_settings, const Settings& settings) noexcept
+{
+    return prev_settings.textures_count     == settings.textures_count
+        && prev_settings.texture_dimensions == settings.texture_dimensions
+        && prev_settings.random_seed        == settings.random_seed;
+}
+
+void AsteroidsArray::ContentState::GenerateTextures(tf::Executor& parallel_executor, const Settings& settings, std::mt19937& rng,
+                                                    ContentProgress* progress_ptr)
+{
+    META_FUNCTION_TASK();
 
     // Randomly generate perlin-noise textures
     std::uniform_real_distribution<float> noise_gain_distribution(0.2F, 0.8F);
-    std::uniform_real_distribution<float> noise_fractal_distribution(0.3F, 0.7F);
     std::uniform_real_distribution<float> noise_lacunarity_distribution(1.5F, 2.5F);
     std::uniform_real_distribution<float> noise_scale_distribution(0.05F, 0.1F);
     std::uniform_real_distribution<float> noise_strength_distribution(0.8F, 1.0F);
@@ -134,22 +600,31 @@ AsteroidsArray::ContentState::ContentState(tf::Executor& parallel_executor, cons
     texture_array_subresources.resize(settings.textures_count);
     tf::Taskflow task_flow;
     task_flow.for_each(texture_array_subresources.begin(), texture_array_subresources.end(),
-        [&rng, &noise_gain_distribution, &noise_fractal_distribution, &noise_lacunarity_distribution,
-         &noise_scale_distribution, &noise_strength_distribution, &settings]
+        [&rng, &noise_gain_distribution, &noise_lacunarity_distribution,
+         &noise_scale_distribution, &noise_strength_distribution, &settings, progress_ptr]
         (rhi::SubResources& sub_resources)
         {
+            if (progress_ptr && progress_ptr->IsCancelled())
+                return;
+
             sub_resources = Asteroid::GenerateTextureArraySubResources(settings.texture_dimensions, 3U,
                 Asteroid::TextureNoiseParameters
                 {
                     .random_seed    = static_cast<int>(rng()),
                     .gain           = noise_gain_distribution(rng),
-                    .fractal_weight = noise_fractal_distribution(rng),
                     .lacunarity     = noise_lacunarity_distribution(rng),
                     .scale          = noise_scale_distribution(rng),
                     .strength       = noise_strength_distribution(rng)
                 });
+            if (progress_ptr)
+                progress_ptr->CompleteSteps();
         });
     parallel_executor.run(task_flow).get();
+}
+
+void AsteroidsArray::ContentState::GenerateMeshSubsetTextureIndices(const Settings& settings, std::mt19937& rng)
+{
+    META_FUNCTION_TASK();
 
     // Randomly distribute textures between uber-mesh subsets
     std::uniform_int_distribution<uint32_t> textures_distribution(0U, settings.textures_count - 1);
@@ -158,59 +633,118 @@ AsteroidsArray::ContentState::ContentState(tf::Executor& parallel_executor, cons
     {
         mesh_subset_texture_index = textures_distribution(rng);
     }
+}
 
-    // Randomly generate parameters of each asteroid in array
-    const float    orbit_radius = settings.orbit_radius_ratio * settings.scale;
-    const float    disc_radius  = settings.disc_radius_ratio  * settings.scale;
-
-    std::normal_distribution<float>         normal_distribution;
-    std::uniform_int_distribution<uint32_t> mesh_distribution(0U, settings.unique_mesh_count - 1);
-    std::uniform_int_distribution<uint32_t> colors_distribution(0, static_cast<uint32_t>(Asteroid::color_schema_size - 1));
-    std::uniform_real_distribution<float>   scale_distribution(settings.min_asteroid_scale_ratio, settings.max_asteroid_scale_ratio);
-    std::uniform_real_distribution<float>   scale_proportion_distribution(0.8F, 1.2F);
-    std::uniform_real_distribution<float>   spin_velocity_distribution(-1.7F, 1.7F);
-    std::uniform_real_distribution<float>   orbit_velocity_distribution(1.5F, 5.F);
-    std::normal_distribution<float>         orbit_radius_distribution(orbit_radius, 0.6F * disc_radius);
-    std::normal_distribution<float>         orbit_height_distribution(0.0F, 0.4F * disc_radius);
+void AsteroidsArray::ContentState::ResizeParameters(const Settings& settings, std::mt19937& rng, ContentProgress* progress_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_OR_EQUAL(parameters.size(), settings.instance_count);
+    if (parameters.size() == settings.instance_count)
+    {
+        if (progress_ptr)
+            progress_ptr->CompleteSteps();
+        return;
+    }
 
+    // Randomly generate parameters of each appended asteroid in array
+    std::uniform_int_distribution<uint32_t> textures_distribution(0U, settings.textures_count - 1);
+    AsteroidParametersGenerator parameters_generator(settings);
     parameters.reserve(settings.instance_count);
+    for (auto asteroid_index = static_cast<uint32_t>(parameters.size()); asteroid_index < settings.instance_count; ++asteroid_index)
+    {
+        parameters.emplace_back(parameters_generator.Generate(rng, textures_distribution, asteroid_index));
+    }
+    if (progress_ptr)
+        progress_ptr->CompleteSteps();
+}
 
-    for (uint32_t asteroid_index = 0; asteroid_index < settings.instance_count; ++asteroid_index)
+bool AsteroidsArray::ContentState::UpdateBeltPages(const Settings& settings, float elapsed_radians)
+{
+    META_FUNCTION_TASK();
+    const uint32_t resident_pages_count = GetBeltResidentPagesCount(settings);
+    const float    page_angle_rad       = 2.F * static_cast<float>(std::numbers::pi) / static_cast<float>(settings.belt_pages_count);
+    const float    camera_angle_rad     = GetOrbitAngle(settings.view_camera.GetOrientation().eye);
+    const auto     camera_page_index    = static_cast<uint32_t>(std::floor(camera_angle_rad / page_angle_rad)) % settings.belt_pages_count;
+
+    // Pages in range of the camera page are wrapped around the belt ring
+    std::vector<uint32_t> required_page_indices;
+    required_page_indices.reserve(resident_pages_count);
+    const auto pages_count = static_cast<int64_t>(settings.belt_pages_count);
+    for (uint32_t page_offset = 0; page_offset < resident_pages_count; ++page_offset)
     {
-        const uint32_t       asteroid_mesh_index   = mesh_distribution(rng);
-        const float          asteroid_orbit_radius = orbit_radius_distribution(rng);
-        const float          asteroid_orbit_height = orbit_height_distribution(rng);
-        const float          asteroid_scale_ratio  = scale_distribution(rng);
-        const float          asteroid_scale        = asteroid_scale_ratio * settings.scale;
-        const hlslpp::float3 asteroid_scale_ratios = hlslpp::float3(scale_proportion_distribution(rng),
-                                                                    scale_proportion_distribution(rng),
-                                                                    scale_proportion_distribution(rng)) * asteroid_scale_ratio;
+        const int64_t page_index = static_cast<int64_t>(camera_page_index) + page_offset - settings.belt_resident_radius;
+        required_page_indices.push_back(static_cast<uint32_t>((page_index % pages_count + pages_count) % pages_count));
+    }
 
-        hlslpp::float4x4 scale_translate_matrix = hlslpp::mul(
-            hlslpp::float4x4::scale(asteroid_scale_ratios * settings.scale),
-            hlslpp::float4x4::translation(asteroid_orbit_radius, asteroid_orbit_height, 0.F)
-        );
-        Asteroid::Colors asteroid_colors = normal_distribution(rng) <= 1.F
-                                         ? Asteroid::GetAsteroidIceColors(colors_distribution(rng), colors_distribution(rng))
-                                         : Asteroid::GetAsteroidRockColors(colors_distribution(rng), colors_distribution(rng));
+    if (resident_belt_pages.size() != resident_pages_count)
+    {
+        resident_belt_pages.assign(resident_pages_count, BeltPage{ std::numeric_limits<uint32_t>::max(), 0.F, 0.F });
+        parameters.clear();
+    }
+
+    // Keep resident pages which are still in range at their slots and collect slots of pages out of range;
+    // asteroids of the page drift out of its sector with their orbital speeds, so the page is also released
+    // when its asteroids have drifted by the page angle on average and is generated again at the current orbital phase
+    std::vector<uint32_t> free_slot_indices;
+    for (uint32_t slot_index = 0; slot_index < resident_pages_count; ++slot_index)
+    {
+        const BeltPage& belt_page        = resident_belt_pages[slot_index];
+        const float     page_drift_rad   = std::abs(elapsed_radians - belt_page.generation_elapsed_radians) * belt_page.mean_orbit_speed;
+        const auto      required_page_it = std::find(required_page_indices.begin(), required_page_indices.end(), belt_page.page_index);
+        if (required_page_it == required_page_indices.end() || page_drift_rad >= page_angle_rad)
+            free_slot_indices.push_back(slot_index);
+        else
+            required_page_indices.erase(required_page_it);
+    }
 
-        parameters.emplace_back(
-            Asteroid::Parameters
+    if (free_slot_indices.empty())
+        return false;
+
+    // Assign pages coming into range or drifted out of their sectors to the free slots
+    const size_t page_parameters_count = settings.belt_page_size;
+    Parameters   resident_parameters;
+    resident_parameters.reserve(static_cast<size_t>(resident_pages_count) * page_parameters_count);
+    for (uint32_t slot_index = 0; slot_index < resident_pages_count; ++slot_index)
+    {
+        const auto free_slot_it = std::find(free_slot_indices.begin(), free_slot_indices.end(), slot_index);
+        if (free_slot_it == free_slot_indices.end())
+        {
+            // Parameters of pages staying resident are copied as is
+            for (size_t parameters_index = slot_index * page_parameters_count; parameters_index < (slot_index + 1) * page_parameters_count; ++parameters_index)
             {
-                .index                  = asteroid_index,
-                .mesh_instance_index    = asteroid_mesh_index,
-                .texture_index          = settings.textures_array_enabled ? textures_distribution(rng) : 0U,
-                .colors                 = std::move(asteroid_colors),
-                .scale_translate_matrix = std::move(scale_translate_matrix),
-                .spin_axis              = GetRandomDirection(rng),
-                .scale                  = asteroid_scale,
-                .orbit_speed            = orbit_velocity_distribution(rng) / (asteroid_scale * asteroid_orbit_radius),
-                .spin_speed             = spin_velocity_distribution(rng)  / asteroid_scale,
-                .spin_angle_rad         = static_cast<float>(std::numbers::pi) * normal_distribution(rng),
-                .orbit_angle_rad        = static_cast<float>(std::numbers::pi) * normal_distribution(rng) * 2.F
+                resident_parameters.emplace_back(parameters[parameters_index]);
             }
-        );
+            continue;
+        }
+
+        // Every kept slot took one required page, so required pages left match the free slots one to one
+        const auto free_slot_offset = static_cast<size_t>(std::distance(free_slot_indices.begin(), free_slot_it));
+        META_CHECK_LESS(free_slot_offset, required_page_indices.size());
+        const uint32_t page_index = required_page_indices[free_slot_offset];
+
+        AsteroidParametersGenerator parameters_generator(settings);
+        std::uniform_int_distribution<uint32_t> textures_distribution(0U, settings.textures_count - 1);
+        std::mt19937 page_rng(settings.random_seed ^ (page_index * 0x9E3779B9U)); // NOSONAR - using pseudorandom generator is safe here
+        const AsteroidParametersGenerator::OrbitSector orbit_sector{
+            .angle_begin_rad = static_cast<float>(page_index) * page_angle_rad,
+            .angle_size_rad  = page_angle_rad,
+            .elapsed_radians = elapsed_radians
+        };
+
+        float orbit_speeds_sum = 0.F;
+        for (uint32_t page_asteroid_index = 0; page_asteroid_index < settings.belt_page_size; ++page_asteroid_index)
+        {
+            const Asteroid::Parameters& asteroid_parameters = resident_parameters.emplace_back(
+                parameters_generator.Generate(page_rng, textures_distribution,
+                                              slot_index * settings.belt_page_size + page_asteroid_index,
+                                              &orbit_sector));
+            orbit_speeds_sum += std::abs(asteroid_parameters.orbit_speed);
+        }
+        resident_belt_pages[slot_index] = BeltPage{ page_index, elapsed_radians, orbit_speeds_sum / static_cast<float>(settings.belt_page_size) };
     }
+
+    parameters.swap(resident_parameters);
+    return true;
 }
 
 AsteroidsArray::AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
@@ -225,13 +759,15 @@ AsteroidsArray::AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
 AsteroidsArray::AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
                                const rhi::RenderPattern& render_pattern,
                                const Settings& settings,
-                               ContentState& state)
+                               ContentState& state,
+                               ResourcesCreation resources_creation)
     : BaseBuffers(render_cmd_queue, state.uber_mesh, "Asteroids Array")
-    , m_settings(settings)
+    , m_settings(GetBeltAdjustedSettings(settings))
     , m_render_cmd_queue(render_cmd_queue)
     , m_content_state_ptr(state.shared_from_this())
     , m_mesh_subset_by_instance_index(m_settings.instance_count, 0U)
-    , m_min_mesh_lod_screen_size_log_2(std::log2(m_settings.mesh_lod_min_screen_size))
+    , m_mesh_lod_screen_error(m_settings.mesh_lod_screen_error)
+    , m_mesh_lod_triangle_budget(m_settings.mesh_lod_triangle_budget)
 {
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsArray::AsteroidsArray");
@@ -240,26 +776,55 @@ AsteroidsArray::AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
     const size_t textures_array_size = m_settings.textures_array_enabled ? m_settings.textures_count : 1;
     const rhi::Shader::MacroDefinitions macro_definitions{ { "TEXTURES_COUNT", std::to_string(textures_array_size) } };
 
+    // Subset batching and shared bindings use separate shader entry points, which read instance uniforms from structured buffer
+    // by instance index offset from the batch root constants or from per-instance vertex stream, instead of mesh uniforms buffer bound per instance
+    const bool instance_uniforms_buffer_used = IsInstanceUniformsBufferUsed();
+    META_CHECK_TRUE_DESCR(m_settings.subset_batching_enabled || !m_settings.gpu_motion_enabled, "GPU motion of asteroids requires subset batching");
+    META_CHECK_TRUE_DESCR(!m_settings.gravity_enabled || !m_settings.gpu_motion_enabled, "gravity perturbations of asteroids are integrated on CPU and can not be used with GPU motion");
+    const bool shared_bindings_used = IsSharedBindingsUsed();
+    const char* const batch_vertex_shader_name = m_settings.gpu_motion_enabled ? "AsteroidMotionVS"
+                                               : shared_bindings_used          ? "AsteroidSharedVS"
+                                                                               : "AsteroidBatchVS";
+    rhi::Program::InputBufferLayouts input_buffer_layouts{
+        rhi::Program::InputBufferLayout { state.uber_mesh.GetVertexLayout().GetSemantics() }
+    };
+    if (shared_bindings_used)
+    {
+        // Instance index is stepped per instance, so that its fetch is offset by start instance location of the draw call
+        input_buffer_layouts.push_back(rhi::Program::InputBufferLayout{
+            .argument_semantics = { "INSTANCE_INDEX" },
+            .step_type          = rhi::Program::InputBufferLayout::StepType::PerInstance,
+            .step_rate          = 1U
+        });
+    }
     rhi::Program render_program = context.CreateProgram(
         rhi::Program::Settings
         {
             .shader_set = rhi::Program::ShaderSet
             {
-                { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Asteroids", "AsteroidVS" }, macro_definitions } },
-                { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Asteroids", "AsteroidPS" }, macro_definitions } }
-            },
-            .input_buffer_layouts = rhi::Program::InputBufferLayouts
-            {
-                rhi::Program::InputBufferLayout { state.uber_mesh.GetVertexLayout().GetSemantics() }
-            },
-            .argument_accessors = rhi::Program::ArgumentAccessors
-            {
-                META_PROGRAM_ARG_ROOT_BUFFER_FRAME_CONSTANT(rhi::ShaderType::All, "g_scene_uniforms"),
-                META_PROGRAM_ARG_BUFFER_ADDRESS_MUTABLE(rhi::ShaderType::All, "g_mesh_uniforms")
+                { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Asteroids", instance_uniforms_buffer_used ? batch_vertex_shader_name : "AsteroidVS" }, macro_definitions } },
+                { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Asteroids", instance_uniforms_buffer_used ? "AsteroidBatchPS" : "AsteroidPS" }, macro_definitions } }
             },
+            .input_buffer_layouts = input_buffer_layouts,
+            .argument_accessors = shared_bindings_used
+                                ? rhi::Program::ArgumentAccessors
+                                {
+                                    META_PROGRAM_ARG_ROOT_BUFFER_FRAME_CONSTANT(rhi::ShaderType::All, "g_scene_uniforms")
+                                }
+                                : m_settings.subset_batching_enabled
+                                ? rhi::Program::ArgumentAccessors
+                                {
+                                    META_PROGRAM_ARG_ROOT_BUFFER_FRAME_CONSTANT(rhi::ShaderType::All, "g_scene_uniforms"),
+                                    META_PROGRAM_ARG_ROOT_BUFFER_MUTABLE(rhi::ShaderType::Vertex, "g_batch_constants")
+                                }
+                                : rhi::Program::ArgumentAccessors
+                                {
+                                    META_PROGRAM_ARG_ROOT_BUFFER_FRAME_CONSTANT(rhi::ShaderType::All, "g_scene_uniforms"),
+                                    META_PROGRAM_ARG_BUFFER_ADDRESS_MUTABLE(rhi::ShaderType::All, "g_mesh_uniforms")
+                                },
             .attachment_formats = render_pattern.GetAttachmentFormats()
         });
-    render_program.SetName("Asteroid Shaders");
+    render_program.SetName(instance_uniforms_buffer_used ? "Asteroid Batch Shaders" : "Asteroid Shaders");
 
     m_render_state = context.CreateRenderState(
         rhi::RenderState::Settings
@@ -273,30 +838,32 @@ AsteroidsArray::AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
         });
     m_render_state.SetName("Asteroids Render State");
 
-    SetInstanceCount(m_settings.instance_count);
-
-    // Create texture arrays initialized with sub-resources data
-    uint32_t texture_index = 0U;
-    m_unique_textures.reserve(m_settings.textures_count);
-    for(const rhi::SubResources& texture_subresources : m_content_state_ptr->texture_array_subresources)
+    if (m_settings.balanced_draw_enabled)
     {
-        m_unique_textures.emplace_back(context.CreateTexture(
-            rhi::TextureSettings::ForImage(m_settings.texture_dimensions,
-                                           static_cast<uint32_t>(texture_subresources.size()),
-                                           gfx::PixelFormat::RGBA8Unorm, true)));
-        m_unique_textures.back().SetData(m_render_cmd_queue, texture_subresources);
-        m_unique_textures.back().SetName(fmt::format("Asteroid Texture {:d}", texture_index));
-        texture_index++;
+        m_subset_draw_costs.reserve(state.uber_mesh.GetSubsetCount());
+        for (const gfx::Mesh::Subset& mesh_subset : state.uber_mesh.GetSubsets())
+        {
+            m_subset_draw_costs.push_back(1.F + static_cast<float>(mesh_subset.indices.count) / g_draw_indices_per_cost_unit);
+        }
     }
 
-    // Distribute textures between unique mesh subsets
-    for (uint32_t subset_index = 0; subset_index < m_content_state_ptr->mesh_subset_texture_indices.size(); ++subset_index)
+    if (m_settings.indirect_args_enabled || shared_bindings_used)
     {
-        const uint32_t subset_texture_index = m_content_state_ptr->mesh_subset_texture_indices[subset_index];
-        META_CHECK_LESS(subset_texture_index, m_unique_textures.size());
-        SetSubsetTexture(m_unique_textures[subset_texture_index], subset_index);
+        // Indexed draw arguments of every mesh subset are prepared once, so that update kernel only copies them per asteroid
+        // and shared bindings draws only offset them by start instance
+        m_subset_draw_indexed_args.reserve(state.uber_mesh.GetSubsetCount());
+        for (const gfx::Mesh::Subset& mesh_subset : state.uber_mesh.GetSubsets())
+        {
+            m_subset_draw_indexed_args.push_back(DrawIndexedArgs{
+                .index_count    = static_cast<uint32_t>(mesh_subset.indices.count),
+                .instance_count = 1U,
+                .first_index    = static_cast<uint32_t>(mesh_subset.indices.offset),
+                .base_vertex    = mesh_subset.indices_adjusted ? 0 : static_cast<int32_t>(mesh_subset.vertices.offset),
+                .first_instance = 0U
+            });
+        }
     }
-    
+
     m_texture_sampler = context.CreateSampler(
         rhi::SamplerSettings
         {
@@ -305,8 +872,175 @@ AsteroidsArray::AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
         });
     m_texture_sampler.SetName("Asteroid Texture Sampler");
 
+    if (instance_uniforms_buffer_used)
+    {
+        // Colors palette is uploaded once, so that compact instance uniforms keep only palette indices of asteroid colors
+        const Asteroid::ColorsPalette& colors_palette = Asteroid::GetColorsPalette();
+        std::vector<hlslpp::float4> colors_palette_data;
+        colors_palette_data.reserve(colors_palette.size());
+        for (const gfx::Color3F& color : colors_palette)
+        {
+            colors_palette_data.emplace_back(color.AsVector(), 1.F);
+        }
+        const auto colors_palette_data_size = static_cast<Data::Size>(colors_palette_data.size() * sizeof(hlslpp::float4));
+        m_colors_palette_buffer = context.CreateBuffer(GetStructuredBufferSettings(sizeof(hlslpp::float4), static_cast<uint32_t>(colors_palette_data.size())));
+        m_colors_palette_buffer.SetName("Asteroid Colors Palette Buffer");
+        m_colors_palette_buffer.SetData(m_render_cmd_queue, rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(colors_palette_data.data()), colors_palette_data_size)); // NOSONAR
+    }
+
+    m_unique_textures.reserve(m_settings.textures_count);
+    if (resources_creation == ResourcesCreation::Deferred)
+        return;
+
+    while (!m_is_resident)
+    {
+        CreateNextDeferredResource();
+    }
+}
+
+void AsteroidsArray::CreateNextDeferredResource()
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::CreateNextDeferredResource");
+    if (m_is_resident)
+        return;
+
+    // Create one texture array initialized with sub-resources data per call
+    const TextureArraySubresources& texture_array_subresources = m_content_state_ptr->texture_array_subresources;
+    if (m_unique_textures.size() < texture_array_subresources.size())
+    {
+        const auto               texture_index        = static_cast<uint32_t>(m_unique_textures.size());
+        const rhi::SubResources& texture_subresources = texture_array_subresources[texture_index];
+        m_unique_textures.emplace_back(GetContext().CreateTexture(
+            rhi::TextureSettings::ForImage(m_settings.texture_dimensions,
+                                           static_cast<uint32_t>(texture_subresources.size()),
+                                           gfx::PixelFormat::RGBA8Unorm, true)));
+        m_unique_textures.back().SetData(m_render_cmd_queue, texture_subresources);
+        m_unique_textures.back().SetName(fmt::format("Asteroid Texture {:d}", texture_index));
+        return;
+    }
+
+    if (!m_are_instances_initialized)
+    {
+        // Distribute textures between unique mesh subsets
+        for (uint32_t subset_index = 0; subset_index < m_content_state_ptr->mesh_subset_texture_indices.size(); ++subset_index)
+        {
+            const uint32_t subset_texture_index = m_content_state_ptr->mesh_subset_texture_indices[subset_index];
+            META_CHECK_LESS(subset_texture_index, m_unique_textures.size());
+            SetSubsetTexture(m_unique_textures[subset_texture_index], subset_index);
+        }
+
+        InitializeInstances();
+        m_are_instances_initialized = true;
+        return;
+    }
+
     // Initialize default uniforms to be ready to render right aways
     Update(0.0, 0.0);
+    m_is_resident = true;
+}
+
+bool AsteroidsArray::IsResizable(const Settings& prev_settings, const Settings& settings) noexcept
+{
+    // Render state with shader macro definitions, mesh buffers and textures are kept on resize,
+    // so only instance count and asteroid scale ratios can be changed
+    return ContentState::IsUberMeshReusable(prev_settings, settings)
+        && ContentState::AreTexturesReusable(prev_settings, settings)
+        && !IsBeltStreamingEnabled(prev_settings) && !IsBeltStreamingEnabled(settings)
+        && prev_settings.textures_array_enabled  == settings.textures_array_enabled
+        && prev_settings.subset_batching_enabled == settings.subset_batching_enabled
+        && prev_settings.indirect_args_enabled   == settings.indirect_args_enabled
+        && prev_settings.shared_bindings_enabled == settings.shared_bindings_enabled
+        && prev_settings.gpu_motion_enabled      == settings.gpu_motion_enabled
+        && prev_settings.gravity_enabled         == settings.gravity_enabled;
+}
+
+void AsteroidsArray::Resize(const Settings& settings, ContentState& state)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::Resize");
+    META_CHECK_TRUE_DESCR(IsResizable(m_settings, settings), "asteroids array can not be resized to settings with different content or rendering modes");
+    META_CHECK_EQUAL(state.uber_mesh.GetSubsetCount(), m_content_state_ptr->uber_mesh.GetSubsetCount());
+
+    // Settings keep the view camera reference and can not be re-assigned, so only the resizable settings are changed
+    m_settings.instance_count           = settings.instance_count;
+    m_settings.min_asteroid_scale_ratio = settings.min_asteroid_scale_ratio;
+    m_settings.max_asteroid_scale_ratio = settings.max_asteroid_scale_ratio;
+    m_content_state_ptr                 = state.shared_from_this();
+
+    // Staging data of the previous instances is dropped, so that it is resized on the next simulation step
+    m_mesh_subset_by_instance_index.assign(m_settings.instance_count, 0U);
+    m_asteroid_updates.clear();
+    m_tick_states.clear();
+    m_next_tick_states.clear();
+    m_batch_instance_uniforms.clear();
+    m_batch_instance_indices.clear();
+    m_batch_instance_positions.clear();
+    m_simulated_tick_index = -1;
+    m_instance_batches.clear();
+    m_bounding_spheres.clear();
+    m_draw_priorities.clear();
+
+    InitializeInstances();
+}
+
+void AsteroidsArray::InitializeInstances()
+{
+    META_FUNCTION_TASK();
+    SetInstanceCount(m_settings.instance_count);
+
+    if (m_settings.indirect_args_enabled)
+    {
+        // Records of all instances have zero instances count until they are written by the first update
+        m_draw_indexed_args.assign(m_settings.instance_count, DrawIndexedArgs{});
+    }
+
+    if (IsSharedBindingsUsed())
+    {
+        // Consecutive instance indices are fetched per instance from the vertex stream following uber-mesh vertices,
+        // so that start instance of every draw selects instance uniforms of the drawn asteroid
+        const uint32_t instance_indices_count = std::max(1U, m_settings.instance_count);
+        std::vector<uint32_t> instance_indices(instance_indices_count);
+        std::iota(instance_indices.begin(), instance_indices.end(), 0U);
+
+        const Data::Size instance_indices_size = instance_indices_count * static_cast<Data::Size>(sizeof(uint32_t));
+        m_instance_index_buffer = GetContext().CreateBuffer(rhi::BufferSettings::ForVertexBuffer(instance_indices_size, sizeof(uint32_t)));
+        m_instance_index_buffer.SetName("Asteroids Instance Index Buffer");
+        m_instance_index_buffer.SetData(m_render_cmd_queue, rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(instance_indices.data()), instance_indices_size)); // NOSONAR
+        m_shared_vertex_buffers = rhi::BufferSet(rhi::BufferType::Vertex, {
+            BaseBuffers::GetVertexBuffers()[0].GetInterface(),
+            m_instance_index_buffer.GetInterface()
+        });
+    }
+
+    if (m_settings.gpu_motion_enabled)
+    {
+        // Static motion parameters are uploaded once and re-uploaded only when parameters are regenerated by belt streaming
+        const uint32_t motion_uniforms_count = std::max(1U, m_settings.instance_count);
+        if (!m_motion_uniforms_buffer.IsInitialized() ||
+            m_motion_uniforms_buffer.GetDataSize() != motion_uniforms_count * sizeof(hlslpp::AsteroidMotionUniforms))
+        {
+            m_motion_uniforms_buffer = GetContext().CreateBuffer(GetStructuredBufferSettings(sizeof(hlslpp::AsteroidMotionUniforms), motion_uniforms_count));
+            m_motion_uniforms_buffer.SetName("Asteroid Motion Uniforms Buffer");
+        }
+        UploadMotionUniforms();
+    }
+
+    BuildOrbitalIndex();
+
+    if (m_settings.gravity_enabled)
+    {
+        // Softening length is the smallest asteroid scale, so that accelerations of the closest asteroids are limited
+        m_gravity_ptr = std::make_unique<AsteroidsGravity>(AsteroidsGravity::Settings{
+            .theta            = m_settings.gravity_theta,
+            .tick_rate        = m_settings.gravity_tick_rate,
+            .softening_length = m_settings.min_asteroid_scale_ratio * m_settings.scale
+        });
+        m_gravity_ptr->Reset(GetContext().GetParallelExecutor(), m_content_state_ptr->parameters, 0.0);
+        UpdateGravityBandBounds();
+    }
 }
 
 AsteroidsArray::AsteroidMeshBufferBindings AsteroidsArray::CreateProgramBindings(
@@ -317,6 +1051,12 @@ AsteroidsArray::AsteroidMeshBufferBindings AsteroidsArray::CreateProgramBindings
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsArray::CreateProgramBindings");
 
+    if (m_settings.subset_batching_enabled)
+        return CreateBatchProgramBindings(constants_buffer, asteroids_uniforms_buffer, frame_index);
+
+    if (m_settings.shared_bindings_enabled)
+        return CreateSharedProgramBindings(constants_buffer, frame_index);
+
     AsteroidMeshBufferBindings asteroid_mesh_buffer_bindings;
     asteroid_mesh_buffer_bindings.uniforms_buffer = asteroids_uniforms_buffer;
     if (m_settings.instance_count == 0)
@@ -369,139 +1109,1384 @@ AsteroidsArray::AsteroidMeshBufferBindings AsteroidsArray::CreateProgramBindings
     return asteroid_mesh_buffer_bindings;
 }
 
-bool AsteroidsArray::Update(double elapsed_seconds, double /*delta_seconds*/)
-{
-    META_FUNCTION_TASK();
+AsteroidsArray::AsteroidMeshBufferBindings AsteroidsArray::CreateBatchProgramBindings(
+    const rhi::Buffer& constants_buffer,
+    const rhi::Buffer& asteroids_uniforms_buffer,
+    Data::Index frame_index) const
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::CreateBatchProgramBindings");
+
+    AsteroidMeshBufferBindings asteroid_mesh_buffer_bindings;
+    asteroid_mesh_buffer_bindings.uniforms_buffer = asteroids_uniforms_buffer;
+    if (m_settings.instance_count == 0)
+        return asteroid_mesh_buffer_bindings;
+
+    // GPU motion needs only asteroid indices sorted by mesh subset per frame, since motion uniforms are static
+    const bool   gpu_motion_enabled       = m_settings.gpu_motion_enabled;
+    rhi::Buffer& instance_uniforms_buffer = asteroid_mesh_buffer_bindings.instance_uniforms_buffer;
+    instance_uniforms_buffer = GetContext().CreateBuffer(GetStructuredBufferSettings(gpu_motion_enabled ? sizeof(uint32_t) : sizeof(hlslpp::AsteroidInstanceUniforms),
+                                                                                     m_settings.instance_count));
+    instance_uniforms_buffer.SetName(fmt::format("Asteroids Instance {} Buffer {}", gpu_motion_enabled ? "Indices" : "Uniforms", frame_index));
+
+    const auto subsets_count = static_cast<uint32_t>(m_content_state_ptr->uber_mesh.GetSubsetCount());
+    const rhi::ResourceViews face_texture_locations = m_settings.textures_array_enabled
+                                                    ? rhi::CreateResourceViews(m_unique_textures)
+                                                    : rhi::CreateResourceViews(GetSubsetTexture(0));
+
+    std::vector<rhi::ProgramBindings>&          program_bindings_array       = asteroid_mesh_buffer_bindings.program_bindings_per_subset;
+    std::vector<rhi::IProgramArgumentBinding*>& scene_uniforms_binding_ptrs  = asteroid_mesh_buffer_bindings.scene_uniforms_binding_ptrs;
+    std::vector<rhi::IProgramArgumentBinding*>& batch_constants_binding_ptrs = asteroid_mesh_buffer_bindings.batch_constants_binding_ptrs;
+
+    program_bindings_array.resize(subsets_count);
+    scene_uniforms_binding_ptrs.resize(subsets_count, nullptr);
+    batch_constants_binding_ptrs.resize(subsets_count, nullptr);
+
+    rhi::ProgramBindingValueByArgument resource_view_by_argument{
+        { { rhi::ShaderType::Vertex, "g_colors_palette"    }, m_colors_palette_buffer.GetResourceView()  },
+        { { rhi::ShaderType::Pixel,  "g_constants"         }, constants_buffer.GetResourceView()         },
+        { { rhi::ShaderType::Pixel,  "g_face_textures"     }, face_texture_locations                     },
+        { { rhi::ShaderType::Pixel,  "g_texture_sampler"   }, m_texture_sampler.GetResourceView()        },
+    };
+    if (gpu_motion_enabled)
+    {
+        resource_view_by_argument.insert({ { rhi::ShaderType::Vertex, "g_motion_uniforms"   }, m_motion_uniforms_buffer.GetResourceView() });
+        resource_view_by_argument.insert({ { rhi::ShaderType::Vertex, "g_instance_indices"  }, instance_uniforms_buffer.GetResourceView() });
+    }
+    else
+    {
+        resource_view_by_argument.insert({ { rhi::ShaderType::Vertex, "g_instance_uniforms" }, instance_uniforms_buffer.GetResourceView() });
+    }
+
+    program_bindings_array[0] = m_render_state.GetProgram().CreateBindings(resource_view_by_argument, frame_index);
+    program_bindings_array[0].SetName(fmt::format("Asteroids Subset[0] Bindings {}", frame_index));
+    scene_uniforms_binding_ptrs[0]  = &program_bindings_array[0].Get({ rhi::ShaderType::All,    "g_scene_uniforms" });
+    batch_constants_binding_ptrs[0] = &program_bindings_array[0].Get({ rhi::ShaderType::Vertex, "g_batch_constants" });
+
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(1U, subsets_count, 1U,
+        [this, &program_bindings_array, &scene_uniforms_binding_ptrs, &batch_constants_binding_ptrs, frame_index](const uint32_t subset_index)
+        {
+            rhi::ProgramBindingValueByArgument set_resource_view_by_argument;
+            if (!m_settings.textures_array_enabled)
+            {
+                set_resource_view_by_argument.insert(
+                    { { rhi::ShaderType::Pixel, "g_face_textures" }, GetSubsetTexture(subset_index).GetResourceView() }
+                );
+            }
+            rhi::ProgramBindings& subset_program_bindings = program_bindings_array[subset_index];
+            subset_program_bindings = rhi::ProgramBindings(program_bindings_array[0], set_resource_view_by_argument, frame_index);
+            subset_program_bindings.SetName(fmt::format("Asteroids Subset[{}] Bindings {}", subset_index, frame_index));
+            scene_uniforms_binding_ptrs[subset_index]  = &subset_program_bindings.Get({ rhi::ShaderType::All,    "g_scene_uniforms" });
+            batch_constants_binding_ptrs[subset_index] = &subset_program_bindings.Get({ rhi::ShaderType::Vertex, "g_batch_constants" });
+        }
+    );
+    GetContext().GetParallelExecutor().run(task_flow).get();
+
+    return asteroid_mesh_buffer_bindings;
+}
+
+AsteroidsArray::AsteroidMeshBufferBindings AsteroidsArray::CreateSharedProgramBindings(
+    const rhi::Buffer& constants_buffer,
+    Data::Index frame_index) const
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::CreateSharedProgramBindings");
+
+    AsteroidMeshBufferBindings asteroid_mesh_buffer_bindings;
+    if (m_settings.instance_count == 0)
+        return asteroid_mesh_buffer_bindings;
+
+    // Compact instance uniforms are stored in structured buffer by instance index, which is fetched in vertex shader from per-instance vertex stream
+    rhi::Buffer& instance_uniforms_buffer = asteroid_mesh_buffer_bindings.instance_uniforms_buffer;
+    instance_uniforms_buffer = GetContext().CreateBuffer(GetStructuredBufferSettings(sizeof(hlslpp::AsteroidInstanceUniforms), m_settings.instance_count));
+    instance_uniforms_buffer.SetName(fmt::format("Asteroids Instance Uniforms Buffer {}", frame_index));
+
+    // Bindings differ only by face textures, so one bindings object is needed per texture when textures array is disabled;
+    // bindings are not changed on draw, so the same bindings are used by all parallel command lists
+    const auto groups_count = static_cast<uint32_t>(m_settings.textures_array_enabled ? 1U : m_unique_textures.size());
+    const rhi::ResourceViews face_texture_locations = m_settings.textures_array_enabled
+                                                    ? rhi::CreateResourceViews(m_unique_textures)
+                                                    : rhi::CreateResourceViews(m_unique_textures.front());
+
+    std::vector<rhi::ProgramBindings>&          program_bindings_array      = asteroid_mesh_buffer_bindings.shared_program_bindings;
+    std::vector<rhi::IProgramArgumentBinding*>& scene_uniforms_binding_ptrs = asteroid_mesh_buffer_bindings.scene_uniforms_binding_ptrs;
+
+    asteroid_mesh_buffer_bindings.shared_bindings_groups_count = groups_count;
+    program_bindings_array.resize(groups_count);
+    scene_uniforms_binding_ptrs.resize(groups_count, nullptr);
+
+    program_bindings_array[0] = m_render_state.GetProgram().CreateBindings({
+        { { rhi::ShaderType::Vertex, "g_colors_palette"    }, m_colors_palette_buffer.GetResourceView()  },
+        { { rhi::ShaderType::Vertex, "g_instance_uniforms" }, instance_uniforms_buffer.GetResourceView() },
+        { { rhi::ShaderType::Pixel,  "g_constants"         }, constants_buffer.GetResourceView()         },
+        { { rhi::ShaderType::Pixel,  "g_face_textures"     }, face_texture_locations                     },
+        { { rhi::ShaderType::Pixel,  "g_texture_sampler"   }, m_texture_sampler.GetResourceView()        },
+    }, frame_index);
+
+    for (uint32_t group_index = 0U; group_index < groups_count; ++group_index)
+    {
+        rhi::ProgramBindings& program_bindings = program_bindings_array[group_index];
+        if (group_index > 0U)
+        {
+            program_bindings = rhi::ProgramBindings(program_bindings_array[0], {
+                { { rhi::ShaderType::Pixel, "g_face_textures" }, m_unique_textures[group_index].GetResourceView() }
+            }, frame_index);
+        }
+        program_bindings.SetName(fmt::format("Asteroids Shared Bindings {} {}", group_index, frame_index));
+        scene_uniforms_binding_ptrs[group_index] = &program_bindings.Get({ rhi::ShaderType::All, "g_scene_uniforms" });
+    }
+
+    return asteroid_mesh_buffer_bindings;
+}
+
+bool AsteroidsArray::Update(double elapsed_seconds, double /*delta_seconds*/)
+{
+    META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsArray::Update");
+    const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr, FrameTimingRecorder::Stage::AsteroidsUpdate);
+
+    // GPU motion evaluates model matrices at the render time exactly, so there is nothing to interpolate
+    if (!m_settings.simulation_tick_rate || m_settings.gpu_motion_enabled)
+    {
+        Simulate(elapsed_seconds);
+        return true;
+    }
+
+    // Mesh LODs, draw priorities, collisions and gravity are simulated at fixed tick rate, while model matrices of drawn asteroids
+    // are interpolated at the render time between asteroid poses of this and the next tick, so that asteroids move smoothly between ticks
+    const double tick_period_sec = 1.0 / static_cast<double>(m_settings.simulation_tick_rate);
+    const auto   tick_index      = static_cast<int64_t>(std::floor(elapsed_seconds / tick_period_sec));
+    const double tick_seconds    = static_cast<double>(tick_index) * tick_period_sec;
+    if (tick_index != m_simulated_tick_index)
+    {
+        const bool are_parameters_changed = Simulate(tick_seconds);
+        UpdateTickStates(tick_seconds, tick_seconds + tick_period_sec, !are_parameters_changed && tick_index == m_simulated_tick_index + 1);
+        m_simulated_tick_index = tick_index;
+    }
+
+    UpdateModelMatrices(std::clamp(static_cast<float>((elapsed_seconds - tick_seconds) / tick_period_sec), 0.F, 1.F));
+    return true;
+}
+
+template<typename FuncType>
+void AsteroidsArray::ForEachParameters(const FuncType& parameters_func) const
+{
+    META_FUNCTION_TASK();
+    const Parameters& parameters = m_content_state_ptr->parameters;
+    ForEachParametersRange(
+        [&parameters, &parameters_func](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsArray::ForEachParameters::Chunk", end_index - begin_index);
+            for (uint32_t asteroid_index = begin_index; asteroid_index < end_index; ++asteroid_index)
+            {
+                parameters_func(parameters[asteroid_index]);
+            }
+        }
+    );
+}
+
+template<typename FuncType>
+uint32_t AsteroidsArray::SumForEachParameters(const FuncType& parameters_func) const
+{
+    META_FUNCTION_TASK();
+    // Values returned for asteroids are summed in chunks, so that the shared sum is updated once per chunk
+    const Parameters&     parameters = m_content_state_ptr->parameters;
+    std::atomic<uint32_t> sum{ 0U };
+    ForEachParametersRange(
+        [&parameters, &parameters_func, &sum](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsArray::SumForEachParameters::Chunk", end_index - begin_index);
+            uint32_t chunk_sum = 0U;
+            for (uint32_t asteroid_index = begin_index; asteroid_index < end_index; ++asteroid_index)
+            {
+                chunk_sum += parameters_func(parameters[asteroid_index]);
+            }
+            sum.fetch_add(chunk_sum, std::memory_order_relaxed);
+        }
+    );
+    return sum.load();
+}
+
+template<typename RangeFuncType>
+void AsteroidsArray::ForEachParametersRange(const RangeFuncType& range_func) const
+{
+    const auto parameters_count = static_cast<uint32_t>(m_content_state_ptr->parameters.size());
+    if (m_thread_affinity_ptr)
+    {
+        // Asteroids are processed in NUMA node partitions, so that the same asteroids are updated on the same node from frame to frame
+        m_thread_affinity_ptr->ForEachIndexRange(parameters_count, range_func);
+        return;
+    }
+
+    ThreadAffinity::ForEachIndexRange(GetContext().GetParallelExecutor(), parameters_count, range_func);
+}
+
+bool AsteroidsArray::Simulate(double elapsed_seconds)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::Simulate");
     const float elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
 
-    tf::Taskflow update_task_flow;
-    update_task_flow.for_each(m_content_state_ptr->parameters.begin(), m_content_state_ptr->parameters.end(),
-        [this, elapsed_radians](const Asteroid::Parameters& asteroid_parameters)
+    // Camera parameters are used as is, so that LOD selection follows viewport resize and FOV changes
+    const gfx::Camera& view_camera = m_settings.view_camera;
+    m_mesh_lod_error_scale = GetMeshLodErrorScale(view_camera.GetScreenSize().GetHeight(),
+                                                  view_camera.GetParameters().fov_deg * static_cast<float>(std::numbers::pi) / 180.F,
+                                                  m_mesh_lod_triangle_budget ? m_mesh_lod_screen_error : m_mesh_lod_screen_error * m_mesh_lod_bias);
+
+    // Resident belt pages are swapped when camera moves to other belt sector, while uniforms and bindings of instance slots are kept
+    m_content_state_ptr->simulated_elapsed_radians = elapsed_radians;
+    const bool are_parameters_changed = IsBeltStreamingEnabled(m_settings) &&
+                                        m_content_state_ptr->UpdateBeltPages(m_settings, elapsed_radians);
+
+    if (are_parameters_changed)
+    {
+        BuildOrbitalIndex();
+    }
+
+    UpdateMinDrawnPriority();
+
+    if (m_gravity_ptr)
+    {
+        // Regenerated asteroids of streaming belt are placed back to their unperturbed orbits
+        if (are_parameters_changed)
+            m_gravity_ptr->Reset(GetContext().GetParallelExecutor(), m_content_state_ptr->parameters, elapsed_seconds);
+        else
+            m_gravity_ptr->Update(GetContext().GetParallelExecutor(), elapsed_seconds);
+
+        if (are_parameters_changed || m_gravity_ptr->GetStatistics().steps_count > 0U)
+            UpdateGravityBandBounds();
+    }
+
+    if (m_settings.gpu_motion_enabled && are_parameters_changed)
+    {
+        UploadMotionUniforms();
+    }
+
+    if (m_settings.collisions_enabled)
+    {
+        m_bounding_spheres.resize(m_content_state_ptr->parameters.size());
+    }
+
+    if (m_settings.gpu_motion_enabled)
+    {
+        // Only mesh LOD is selected on CPU by asteroid position, which is the orbit rotation of its translation
+        m_motion_elapsed_radians = elapsed_radians;
+        m_asteroid_updates.resize(m_content_state_ptr->parameters.size());
+        m_mesh_lod_triangles_count = SumForEachParameters(
+            [this, elapsed_radians](const Asteroid::Parameters& asteroid_parameters)
+            {
+                const UberMesh&         uber_mesh       = m_content_state_ptr->uber_mesh;
+                const hlslpp::float4x4& scale_translate = asteroid_parameters.scale_translate_matrix;
+                const float             orbit_angle_rad = asteroid_parameters.orbit_angle_rad - asteroid_parameters.orbit_speed * elapsed_radians;
+                const hlslpp::float3    asteroid_position = AsteroidsOrbitalIndex::GetOrbitPosition(
+                    hlslpp::float3(scale_translate._m30, scale_translate._m31, scale_translate._m32), orbit_angle_rad);
+                const uint32_t mesh_subdivision_index = GetMeshSubdivisionIndex(asteroid_parameters, uber_mesh, asteroid_position,
+                                                                                m_settings.view_camera.GetOrientation().eye, m_mesh_lod_error_scale);
+                const uint32_t mesh_subset_index      = uber_mesh.GetSubsetIndex(asteroid_parameters.mesh_instance_index, mesh_subdivision_index);
+                m_asteroid_updates[asteroid_parameters.index].mesh_subset_index = mesh_subset_index;
+                UpdateBoundingSphere(asteroid_parameters, asteroid_position, uber_mesh.GetSubsetDepthRange(mesh_subset_index).second);
+                UpdateDrawPriority(asteroid_parameters, asteroid_position);
+                return GetDrawnTrianglesCount(asteroid_parameters.index, mesh_subset_index);
+            }
+        );
+    }
+    else if (IsInstanceUniformsBufferUsed())
+    {
+        m_asteroid_updates.resize(m_content_state_ptr->parameters.size());
+        m_mesh_lod_triangles_count = SumForEachParameters(
+            [this, elapsed_seconds](const Asteroid::Parameters& asteroid_parameters)
+            {
+                AsteroidUpdate& asteroid_update = m_asteroid_updates[asteroid_parameters.index];
+                asteroid_update = GetAsteroidUpdate(asteroid_parameters, m_settings.view_camera.GetOrientation().eye, elapsed_seconds);
+                const hlslpp::float4x4& model_matrix = asteroid_update.uniforms.model_matrix; // transposed
+                const hlslpp::float3    asteroid_position(model_matrix._m03, model_matrix._m13, model_matrix._m23);
+                UpdateBoundingSphere(asteroid_parameters, asteroid_position, asteroid_update.uniforms.depth_max);
+                UpdateDrawPriority(asteroid_parameters, asteroid_position);
+                return GetDrawnTrianglesCount(asteroid_parameters.index, asteroid_update.mesh_subset_index);
+            }
+        );
+    }
+    else
+    {
+        m_mesh_lod_triangles_count = SumForEachParameters(
+            [this, elapsed_seconds](const Asteroid::Parameters& asteroid_parameters)
+            {
+                UpdateAsteroidUniforms(asteroid_parameters, m_settings.view_camera.GetOrientation().eye, elapsed_seconds);
+                return GetDrawnTrianglesCount(asteroid_parameters.index, m_mesh_subset_by_instance_index[asteroid_parameters.index]);
+            }
+        );
+    }
+
+    if (IsInstanceUniformsBufferUsed())
+    {
+        UpdateInstanceBatches();
+    }
+
+    UpdateMeshLodScreenError();
+
+    if (m_settings.collisions_enabled)
+    {
+        const AsteroidCollisions::Events& collision_events = m_collisions.Detect(GetContext().GetParallelExecutor(), m_bounding_spheres);
+        if (m_collision_events_callback && !collision_events.empty())
+            m_collision_events_callback(collision_events, elapsed_seconds);
+    }
+    return are_parameters_changed;
+}
+
+void AsteroidsArray::UpdateTickStates(double tick_seconds, double next_tick_seconds, bool is_next_tick)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::UpdateTickStates");
+
+    // Poses of the next tick evaluated on the previous tick become poses of this tick, unless asteroid parameters were regenerated
+    const size_t asteroids_count = m_content_state_ptr->parameters.size();
+    const bool   is_tick_state_reused = is_next_tick && m_next_tick_states.size() == asteroids_count;
+    if (is_tick_state_reused)
+        std::swap(m_tick_states, m_next_tick_states);
+    else
+        m_tick_states.resize(asteroids_count);
+
+    m_next_tick_states.resize(asteroids_count);
+    ForEachParameters(
+        [this, tick_seconds, next_tick_seconds, is_tick_state_reused](const Asteroid::Parameters& asteroid_parameters)
         {
-            UpdateAsteroidUniforms(asteroid_parameters, m_settings.view_camera.GetOrientation().eye, elapsed_radians);
+            AsteroidTickState& tick_state = m_tick_states[asteroid_parameters.index];
+            if (!is_tick_state_reused)
+                tick_state = GetAsteroidTickState(asteroid_parameters, tick_seconds);
+
+            // Quaternions of the next tick are kept in the same hemisphere, so that interpolation follows the shortest arc
+            AsteroidTickState& next_tick_state = m_next_tick_states[asteroid_parameters.index];
+            next_tick_state = GetAsteroidTickState(asteroid_parameters, next_tick_seconds);
+            if (static_cast<float>(hlslpp::dot(tick_state.spin_rotation, next_tick_state.spin_rotation)) < 0.F)
+                next_tick_state.spin_rotation = -next_tick_state.spin_rotation;
+            if (static_cast<float>(hlslpp::dot(tick_state.orbit_rotation, next_tick_state.orbit_rotation)) < 0.F)
+                next_tick_state.orbit_rotation = -next_tick_state.orbit_rotation;
         }
     );
+}
 
-    GetContext().GetParallelExecutor().run(update_task_flow).get();
-    return true;
+void AsteroidsArray::UpdateModelMatrices(float tick_ratio)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::UpdateModelMatrices");
+    META_CHECK_EQUAL(m_tick_states.size(), m_content_state_ptr->parameters.size());
+    META_CHECK_EQUAL(m_next_tick_states.size(), m_content_state_ptr->parameters.size());
+
+    // Hidden asteroids are skipped, since they are not drawn until the next simulation tick
+    ForEachParameters(
+        [this, tick_ratio](const Asteroid::Parameters& asteroid_parameters)
+        {
+            if (!IsAsteroidDrawn(asteroid_parameters.index))
+                return;
+
+            const AsteroidTickState& tick_state      = m_tick_states[asteroid_parameters.index];
+            const AsteroidTickState& next_tick_state = m_next_tick_states[asteroid_parameters.index];
+            const hlslpp::float4x4&  scale_translate = asteroid_parameters.scale_translate_matrix;
+            const hlslpp::float4x4   model_matrix    = hlslpp::transpose(GetAsteroidInterpolatedModelMatrix(
+                hlslpp::float3(scale_translate._m00, scale_translate._m11, scale_translate._m22),
+                tick_state.spin_rotation,  next_tick_state.spin_rotation,
+                tick_state.orbit_rotation, next_tick_state.orbit_rotation,
+                tick_state.position,       next_tick_state.position,
+                tick_ratio));
+
+            if (IsInstanceUniformsBufferUsed())
+            {
+                if (const uint32_t batch_position = m_batch_instance_positions[asteroid_parameters.index];
+                    batch_position != g_hidden_batch_position)
+                    SetInstanceModelMatrix(m_batch_instance_uniforms[batch_position], model_matrix);
+                return;
+            }
+
+            hlslpp::AsteroidUniforms uniforms = GetFinalPassUniforms(asteroid_parameters.index);
+            uniforms.model_matrix = model_matrix;
+            SetFinalPassUniforms(uniforms, asteroid_parameters.index);
+        }
+    );
 }
 
 void AsteroidsArray::Draw(const rhi::RenderCommandList& cmd_list,
-                          const gfx::InstancedMeshBufferBindings& buffer_bindings,
+                          const AsteroidMeshBufferBindings& buffer_bindings,
                           const rhi::ViewState& view_state)
 {
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsArray::Draw");
-    META_CHECK_GREATER_OR_EQUAL(buffer_bindings.uniforms_buffer.GetDataSize(), GetUniformsBufferSize());
+    const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr, FrameTimingRecorder::Stage::DrawEncoding);
 
     // Upload uniforms buffer data to GPU asynchronously while encoding drawing commands on CPU
     auto uniforms_update_future = std::async([this, &buffer_bindings]() {
-        buffer_bindings.uniforms_buffer.SetData(m_render_cmd_queue, GetFinalPassUniformsSubresource());
+        UploadUniforms(buffer_bindings);
     });
 
     META_DEBUG_GROUP_VAR(s_debug_group, "Asteroids rendering");
     cmd_list.ResetWithState(m_render_state, &s_debug_group);
     cmd_list.SetViewState(view_state);
 
+    if (m_settings.subset_batching_enabled)
+    {
+        DrawInstanceBatches(cmd_list, buffer_bindings, m_instance_batches.begin(), m_instance_batches.end());
+        uniforms_update_future.wait();
+        return;
+    }
+
+    if (m_settings.shared_bindings_enabled)
+    {
+        DrawWithSharedBindings(cmd_list, buffer_bindings, 0U, m_settings.instance_count);
+        uniforms_update_future.wait();
+        return;
+    }
+
     META_CHECK_EQUAL(buffer_bindings.program_bindings_per_instance.size(), m_settings.instance_count);
-    BaseBuffers::Draw(
-        cmd_list,
-        buffer_bindings.program_bindings_per_instance,
-        { rhi::ProgramBindings::ApplyBehavior::ConstantOnce }, // Constant bindings are applied once mutable always, resource barriers are not set to reduce overhead
-        0,
-        true, // Bound resources are not retained by command lists to reduce overhead from the huge amount of bindings
-        false // Do not set resource barriers for Vertex and Index buffers since their state does not change and to reduce runtime overhead
-    );
+    if (m_settings.indirect_args_enabled)
+    {
+        DrawIndexedArgsRange(cmd_list, buffer_bindings, m_draw_indexed_args.begin(), m_draw_indexed_args.end());
+        uniforms_update_future.wait();
+        return;
+    }
+
+    DrawDrawnInstances(cmd_list, buffer_bindings, 0U, m_settings.instance_count);
 
     // Make sure that uniforms have finished uploading to GPU
     uniforms_update_future.wait();
 }
 
 void AsteroidsArray::DrawParallel(const rhi::ParallelRenderCommandList& parallel_cmd_list,
-                                  const gfx::InstancedMeshBufferBindings& buffer_bindings,
+                                  const AsteroidMeshBufferBindings& buffer_bindings,
                                   const rhi::ViewState& view_state)
 {
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("AsteroidsArray::DrawParallel");
-    META_CHECK_GREATER_OR_EQUAL(buffer_bindings.uniforms_buffer.GetDataSize(), GetUniformsBufferSize());
+    const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr, FrameTimingRecorder::Stage::DrawEncoding);
 
     // Upload uniforms buffer data to GPU asynchronously while encoding drawing commands on CPU
     auto uniforms_update_future = std::async([this, &buffer_bindings]() {
-        buffer_bindings.uniforms_buffer.SetData(m_render_cmd_queue, GetFinalPassUniformsSubresource());
+        UploadUniforms(buffer_bindings);
     });
 
     META_DEBUG_GROUP_VAR(s_debug_group, "Parallel Asteroids rendering");
     parallel_cmd_list.ResetWithState(m_render_state, &s_debug_group);
     parallel_cmd_list.SetViewState(view_state);
 
+    if (m_settings.subset_batching_enabled)
+    {
+        // Instance batches are split in contiguous ranges between parallel render command lists
+        const std::vector<rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+        const auto   cmd_lists_count      = static_cast<uint32_t>(render_cmd_lists.size());
+        const size_t batches_count        = m_instance_batches.size();
+        const size_t batches_per_cmd_list = (batches_count + cmd_lists_count - 1) / cmd_lists_count;
+
+        tf::Taskflow draw_task_flow;
+        draw_task_flow.for_each_index(0U, cmd_lists_count, 1U,
+            [this, &render_cmd_lists, &buffer_bindings, batches_count, batches_per_cmd_list](const uint32_t cmd_list_index)
+            {
+                const FrameTimingRecorder::ThreadEncodingTimer encoding_timer(m_frame_timing_recorder_ptr, cmd_list_index);
+                const size_t begin_batch_index = std::min(batches_count, cmd_list_index * batches_per_cmd_list);
+                const size_t end_batch_index   = std::min(batches_count, begin_batch_index + batches_per_cmd_list);
+                DrawInstanceBatches(render_cmd_lists[cmd_list_index], buffer_bindings,
+                                    m_instance_batches.begin() + static_cast<std::ptrdiff_t>(begin_batch_index),
+                                    m_instance_batches.begin() + static_cast<std::ptrdiff_t>(end_batch_index));
+            }
+        );
+        GetContext().GetParallelExecutor().run(draw_task_flow).get();
+        uniforms_update_future.wait();
+        return;
+    }
+
+    if (m_settings.shared_bindings_enabled)
+    {
+        // Asteroid instances are split in contiguous ranges between parallel render command lists,
+        // which all use the same shared bindings, since they are not changed while encoding draws
+        const std::vector<rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+        const auto     cmd_lists_count        = static_cast<uint32_t>(render_cmd_lists.size());
+        const uint32_t instances_per_cmd_list = (m_settings.instance_count + cmd_lists_count - 1) / cmd_lists_count;
+
+        tf::Taskflow draw_task_flow;
+        draw_task_flow.for_each_index(0U, cmd_lists_count, 1U,
+            [this, &render_cmd_lists, &buffer_bindings, instances_per_cmd_list](const uint32_t cmd_list_index)
+            {
+                const FrameTimingRecorder::ThreadEncodingTimer encoding_timer(m_frame_timing_recorder_ptr, cmd_list_index);
+                const uint32_t begin_instance_index = std::min(m_settings.instance_count, cmd_list_index * instances_per_cmd_list);
+                const uint32_t end_instance_index   = std::min(m_settings.instance_count, begin_instance_index + instances_per_cmd_list);
+                DrawWithSharedBindings(render_cmd_lists[cmd_list_index], buffer_bindings, begin_instance_index, end_instance_index);
+            }
+        );
+        GetContext().GetParallelExecutor().run(draw_task_flow).get();
+        uniforms_update_future.wait();
+        return;
+    }
+
     META_CHECK_EQUAL(buffer_bindings.program_bindings_per_instance.size(), m_settings.instance_count);
-    BaseBuffers::DrawParallel(
-        parallel_cmd_list,
-        buffer_bindings.program_bindings_per_instance,
-        { rhi::ProgramBindings::ApplyBehavior::ConstantOnce }, // Constant bindings are applied once, mutable always, resource barriers are not set to reduce overhead
-        true,   // Bound resources are not retained by command lists to reduce overhead from the huge amount of bindings
-        false   // Do not set resource barriers for Vertex and Index buffers since their state does not change and to reduce runtime overhead
+    if (m_settings.indirect_args_enabled)
+    {
+        // Draw argument records are split in contiguous ranges between parallel render command lists
+        const std::vector<rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+        const auto   cmd_lists_count        = static_cast<uint32_t>(render_cmd_lists.size());
+        const size_t draw_args_count        = m_draw_indexed_args.size();
+        const size_t draw_args_per_cmd_list = (draw_args_count + cmd_lists_count - 1) / cmd_lists_count;
+
+        tf::Taskflow draw_task_flow;
+        draw_task_flow.for_each_index(0U, cmd_lists_count, 1U,
+            [this, &render_cmd_lists, &buffer_bindings, draw_args_count, draw_args_per_cmd_list](const uint32_t cmd_list_index)
+            {
+                const FrameTimingRecorder::ThreadEncodingTimer encoding_timer(m_frame_timing_recorder_ptr, cmd_list_index);
+                const size_t begin_args_index = std::min(draw_args_count, cmd_list_index * draw_args_per_cmd_list);
+                const size_t end_args_index   = std::min(draw_args_count, begin_args_index + draw_args_per_cmd_list);
+                DrawIndexedArgsRange(render_cmd_lists[cmd_list_index], buffer_bindings,
+                                     m_draw_indexed_args.begin() + static_cast<std::ptrdiff_t>(begin_args_index),
+                                     m_draw_indexed_args.begin() + static_cast<std::ptrdiff_t>(end_args_index));
+            }
+        );
+        GetContext().GetParallelExecutor().run(draw_task_flow).get();
+        uniforms_update_future.wait();
+        return;
+    }
+
+    if (m_settings.balanced_draw_enabled)
+    {
+        DrawParallelBalanced(parallel_cmd_list, buffer_bindings);
+        uniforms_update_future.wait();
+        return;
+    }
+
+    // Asteroid instances are split in contiguous ranges between parallel render command lists
+    const std::vector<rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    const auto     cmd_lists_count        = static_cast<uint32_t>(render_cmd_lists.size());
+    const uint32_t instances_per_cmd_list = (m_settings.instance_count + cmd_lists_count - 1) / cmd_lists_count;
+
+    tf::Taskflow draw_task_flow;
+    draw_task_flow.for_each_index(0U, cmd_lists_count, 1U,
+        [this, &render_cmd_lists, &buffer_bindings, instances_per_cmd_list](const uint32_t cmd_list_index)
+        {
+            const FrameTimingRecorder::ThreadEncodingTimer encoding_timer(m_frame_timing_recorder_ptr, cmd_list_index);
+            const uint32_t begin_instance_index = std::min(m_settings.instance_count, cmd_list_index * instances_per_cmd_list);
+            const uint32_t end_instance_index   = std::min(m_settings.instance_count, begin_instance_index + instances_per_cmd_list);
+            DrawDrawnInstances(render_cmd_lists[cmd_list_index], buffer_bindings, begin_instance_index, end_instance_index);
+        }
     );
+    GetContext().GetParallelExecutor().run(draw_task_flow).get();
     uniforms_update_future.wait();
 }
 
-float AsteroidsArray::GetMinMeshLodScreenSize() const
+void AsteroidsArray::UploadUniforms(const AsteroidMeshBufferBindings& buffer_bindings) const
 {
     META_FUNCTION_TASK();
-    return std::pow(2.F, m_min_mesh_lod_screen_size_log_2);
+    const FrameTimingRecorder::StageTimer stage_timer(m_frame_timing_recorder_ptr, FrameTimingRecorder::Stage::UniformsUpload);
+    if (m_settings.gpu_motion_enabled)
+    {
+        if (m_batch_instance_indices.empty())
+            return;
+
+        const auto instance_indices_data_size = static_cast<Data::Size>(m_batch_instance_indices.size() * sizeof(uint32_t));
+        META_CHECK_GREATER_OR_EQUAL(buffer_bindings.instance_uniforms_buffer.GetDataSize(), instance_indices_data_size);
+        buffer_bindings.instance_uniforms_buffer.SetData(m_render_cmd_queue, rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(m_batch_instance_indices.data()), instance_indices_data_size)); // NOSONAR
+        return;
+    }
+
+    if (IsInstanceUniformsBufferUsed())
+    {
+        if (m_batch_instance_uniforms.empty())
+            return;
+
+        const auto instance_uniforms_data_size = static_cast<Data::Size>(m_batch_instance_uniforms.size() * sizeof(hlslpp::AsteroidInstanceUniforms));
+        META_CHECK_GREATER_OR_EQUAL(buffer_bindings.instance_uniforms_buffer.GetDataSize(), instance_uniforms_data_size);
+        buffer_bindings.instance_uniforms_buffer.SetData(m_render_cmd_queue, rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(m_batch_instance_uniforms.data()), instance_uniforms_data_size)); // NOSONAR
+        return;
+    }
+
+    META_CHECK_GREATER_OR_EQUAL(buffer_bindings.uniforms_buffer.GetDataSize(), GetUniformsBufferSize());
+    buffer_bindings.uniforms_buffer.SetData(m_render_cmd_queue, GetFinalPassUniformsSubresource());
 }
 
-void AsteroidsArray::SetMinMeshLodScreenSize(float mesh_lod_min_screen_size)
+void AsteroidsArray::DrawInstanceBatches(const rhi::RenderCommandList& cmd_list,
+                                         const AsteroidMeshBufferBindings& buffer_bindings,
+                                         InstanceBatches::const_iterator batches_begin,
+                                         InstanceBatches::const_iterator batches_end)
 {
     META_FUNCTION_TASK();
-    m_min_mesh_lod_screen_size_log_2 = std::log2(mesh_lod_min_screen_size);
+    META_CHECK_EQUAL(buffer_bindings.program_bindings_per_subset.size(), m_content_state_ptr->uber_mesh.GetSubsetCount());
+    for (auto batch_it = batches_begin; batch_it != batches_end; ++batch_it)
+    {
+        // Instance offset is passed in root constant, since SV_InstanceID does not include start instance location in all APIs
+        buffer_bindings.batch_constants_binding_ptrs[batch_it->mesh_subset_index]->SetRootConstant(
+            rhi::RootConstant(GetBatchConstants(*batch_it)));
+        BaseBuffers::Draw(cmd_list, buffer_bindings.program_bindings_per_subset[batch_it->mesh_subset_index],
+                          batch_it->mesh_subset_index, batch_it->instance_count);
+    }
 }
 
-uint32_t AsteroidsArray::GetSubsetByInstanceIndex(uint32_t instance_index) const
+hlslpp::AsteroidBatchConstants AsteroidsArray::GetBatchConstants(const InstanceBatch& instance_batch) const
+{
+    META_FUNCTION_TASK();
+    if (!m_settings.gpu_motion_enabled)
+        return hlslpp::AsteroidBatchConstants{ .instance_offset = instance_batch.instance_offset };
+
+    // Mesh depth range and LOD colors are the same for all instances of the batch, so they are passed in batch constants
+    const UberMesh& uber_mesh = m_content_state_ptr->uber_mesh;
+    const auto& [mesh_depth_min, mesh_depth_max] = uber_mesh.GetSubsetDepthRange(instance_batch.mesh_subset_index);
+    uint32_t lod_color_indices = std::numeric_limits<uint32_t>::max();
+    if (m_mesh_lod_coloring_enabled)
+    {
+        const Asteroid::ColorIndices color_indices = Asteroid::GetAsteroidLodColorIndices(uber_mesh.GetSubsetSubdivision(instance_batch.mesh_subset_index));
+        lod_color_indices = color_indices.deep | (color_indices.shallow << 16U);
+    }
+    return hlslpp::AsteroidBatchConstants
+    {
+        .instance_offset   = instance_batch.instance_offset,
+        .lod_color_indices = lod_color_indices,
+        .depth_min         = mesh_depth_min,
+        .depth_max         = mesh_depth_max,
+        .elapsed_radians   = m_motion_elapsed_radians
+    };
+}
+
+bool AsteroidsArray::IsMultiDrawIndirectSupported(const rhi::RenderContext&) noexcept
+{
+    // None of RHI backends exposes indirect draw commands yet, so argument records can not be submitted to GPU
+    return false;
+}
+
+void AsteroidsArray::DrawIndexedArgsRange(const rhi::RenderCommandList& cmd_list,
+                                          const AsteroidMeshBufferBindings& buffer_bindings,
+                                          DrawIndexedArgsArray::const_iterator draw_args_begin,
+                                          DrawIndexedArgsArray::const_iterator draw_args_end) const
+{
+    META_FUNCTION_TASK();
+
+    // Argument records of asteroids, which are not drawn, have zero instances count
+    const auto is_drawn_args = [](const DrawIndexedArgs& draw_args) { return draw_args.instance_count > 0U; };
+    draw_args_begin = std::find_if(draw_args_begin, draw_args_end, is_drawn_args);
+    if (draw_args_begin == draw_args_end)
+        return;
+
+    // Backends without multi-draw-indirect support replay argument records with indexed draw calls:
+    // first draw binds vertex and index buffers of the uber-mesh, which are shared by all the following draws
+    const DrawIndexedArgs& first_draw_args = *draw_args_begin;
+    BaseBuffers::Draw(cmd_list, buffer_bindings.program_bindings_per_instance[first_draw_args.first_instance],
+                      m_mesh_subset_by_instance_index[first_draw_args.first_instance], first_draw_args.instance_count);
+
+    for (auto draw_args_it = std::next(draw_args_begin); draw_args_it != draw_args_end; ++draw_args_it)
+    {
+        if (!is_drawn_args(*draw_args_it))
+            continue;
+
+        cmd_list.SetProgramBindings(buffer_bindings.program_bindings_per_instance[draw_args_it->first_instance],
+                                    rhi::ProgramBindings::ApplyBehaviorMask(rhi::ProgramBindings::ApplyBehavior::ConstantOnce));
+        cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle, draw_args_it->index_count, draw_args_it->first_index,
+                             static_cast<uint32_t>(draw_args_it->base_vertex), draw_args_it->instance_count);
+    }
+}
+
+void AsteroidsArray::DrawParallelBalanced(const rhi::ParallelRenderCommandList& parallel_cmd_list,
+                                          const AsteroidMeshBufferBindings& buffer_bindings)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::DrawParallelBalanced");
+
+    const std::vector<rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    const auto     cmd_lists_count = static_cast<uint32_t>(render_cmd_lists.size());
+    const uint32_t instance_count  = m_settings.instance_count;
+    if (!instance_count)
+        return;
+
+    // Prefix sum of estimated draw costs depending on current mesh LOD of every instance
+    std::vector<float> instance_cost_prefix_sums(instance_count + 1U, 0.F);
+    for (uint32_t instance_index = 0U; instance_index < instance_count; ++instance_index)
+    {
+        instance_cost_prefix_sums[instance_index + 1U] = instance_cost_prefix_sums[instance_index]
+                                                       + (IsAsteroidDrawn(instance_index)
+                                                          ? m_subset_draw_costs[m_mesh_subset_by_instance_index[instance_index]]
+                                                          : 0.F);
+    }
+    const float total_cost = instance_cost_prefix_sums.back();
+    if (total_cost <= 0.F)
+        return;
+
+    // Active command lists count and chunks count are adapted to the encoding time estimated with measurements of previous frames
+    uint32_t active_cmd_lists_count = cmd_lists_count;
+    uint32_t chunks_count           = cmd_lists_count * 4U;
+    if (m_encode_seconds_per_cost > 0.0)
+    {
+        const double estimated_encode_seconds = m_encode_seconds_per_cost * total_cost;
+        active_cmd_lists_count = std::clamp(static_cast<uint32_t>(estimated_encode_seconds / g_cmd_list_min_encode_seconds), 1U, cmd_lists_count);
+        chunks_count           = std::clamp(static_cast<uint32_t>(estimated_encode_seconds / g_draw_chunk_target_seconds),
+                                            active_cmd_lists_count, active_cmd_lists_count * g_max_draw_chunks_per_cmd_list);
+    }
+
+    // Instances are split in chunks of equal estimated cost
+    std::vector<uint32_t> chunk_begin_indices(chunks_count + 1U, instance_count);
+    chunk_begin_indices[0] = 0U;
+    for (uint32_t chunk_index = 1U; chunk_index < chunks_count; ++chunk_index)
+    {
+        const float chunk_begin_cost = total_cost * static_cast<float>(chunk_index) / static_cast<float>(chunks_count);
+        const auto  chunk_begin_it   = std::lower_bound(instance_cost_prefix_sums.begin(), instance_cost_prefix_sums.end() - 1, chunk_begin_cost);
+        chunk_begin_indices[chunk_index] = std::max(chunk_begin_indices[chunk_index - 1U],
+                                                    static_cast<uint32_t>(std::distance(instance_cost_prefix_sums.begin(), chunk_begin_it)));
+    }
+
+    // Chunks are taken dynamically by command list encoding tasks, so that fast threads take over the work of stragglers
+    std::atomic<uint32_t> next_chunk_index{ 0U };
+    m_cmd_list_encode_seconds.assign(cmd_lists_count, 0.0);
+
+    tf::Taskflow draw_task_flow;
+    draw_task_flow.for_each_index(0U, active_cmd_lists_count, 1U,
+        [this, &render_cmd_lists, &buffer_bindings, &chunk_begin_indices, &next_chunk_index, chunks_count](const uint32_t cmd_list_index)
+        {
+            const auto encode_begin_time = std::chrono::high_resolution_clock::now();
+            for (uint32_t chunk_index = next_chunk_index++; chunk_index < chunks_count; chunk_index = next_chunk_index++)
+            {
+                const uint32_t begin_instance_index = chunk_begin_indices[chunk_index];
+                const uint32_t end_instance_index   = chunk_begin_indices[chunk_index + 1U];
+                if (begin_instance_index == end_instance_index)
+                    continue;
+
+                DrawDrawnInstances(render_cmd_lists[cmd_list_index], buffer_bindings, begin_instance_index, end_instance_index);
+            }
+            m_cmd_list_encode_seconds[cmd_list_index] = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - encode_begin_time).count();
+            if (m_frame_timing_recorder_ptr)
+            {
+                m_frame_timing_recorder_ptr->AddThreadEncodingSeconds(cmd_list_index, m_cmd_list_encode_seconds[cmd_list_index]);
+            }
+        }
+    );
+    GetContext().GetParallelExecutor().run(draw_task_flow).get();
+
+    // Encoding time per cost unit is updated with exponential moving average of the total encoding time of all threads
+    double encode_seconds = 0.0;
+    for (const double cmd_list_encode_seconds : m_cmd_list_encode_seconds)
+    {
+        encode_seconds += cmd_list_encode_seconds;
+    }
+    const double encode_seconds_per_cost = encode_seconds / static_cast<double>(total_cost);
+    m_encode_seconds_per_cost = m_encode_seconds_per_cost > 0.0
+                              ? m_encode_seconds_per_cost + (encode_seconds_per_cost - m_encode_seconds_per_cost) * g_encode_seconds_ema_factor
+                              : encode_seconds_per_cost;
+}
+
+void AsteroidsArray::DrawDrawnInstances(const rhi::RenderCommandList& cmd_list,
+                                        const AsteroidMeshBufferBindings& buffer_bindings,
+                                        uint32_t begin_instance_index,
+                                        uint32_t end_instance_index) const
+{
+    META_FUNCTION_TASK();
+    // Consecutive drawn instances are drawn with their program bindings in one mesh buffers draw, while hidden instances are skipped
+    uint32_t drawn_begin_index = begin_instance_index;
+    while (drawn_begin_index < end_instance_index)
+    {
+        while (drawn_begin_index < end_instance_index && !IsAsteroidDrawn(drawn_begin_index))
+            ++drawn_begin_index;
+
+        uint32_t drawn_end_index = drawn_begin_index;
+        while (drawn_end_index < end_instance_index && IsAsteroidDrawn(drawn_end_index))
+            ++drawn_end_index;
+
+        if (drawn_begin_index == drawn_end_index)
+            break;
+
+        BaseBuffers::Draw(
+            cmd_list,
+            buffer_bindings.program_bindings_per_instance.begin() + drawn_begin_index,
+            buffer_bindings.program_bindings_per_instance.begin() + drawn_end_index,
+            { rhi::ProgramBindings::ApplyBehavior::ConstantOnce }, // Constant bindings are applied once, mutable always, resource barriers are not set to reduce overhead
+            drawn_begin_index,
+            true,   // Bound resources are not retained by command lists to reduce overhead from the huge amount of bindings
+            false   // Do not set resource barriers for Vertex and Index buffers since their state does not change and to reduce runtime overhead
+        );
+        drawn_begin_index = drawn_end_index;
+    }
+}
+
+void AsteroidsArray::DrawWithSharedBindings(const rhi::RenderCommandList& cmd_list,
+                                            const AsteroidMeshBufferBindings& buffer_bindings,
+                                            uint32_t begin_instance_index,
+                                            uint32_t end_instance_index) const
 {
     META_FUNCTION_TASK();
+    META_CHECK_EQUAL(buffer_bindings.shared_program_bindings.size(), buffer_bindings.shared_bindings_groups_count);
+    META_CHECK_EQUAL(m_subset_draw_indexed_args.size(), m_content_state_ptr->uber_mesh.GetSubsetCount());
+
+    // Vertex stream of instance indices follows uber-mesh vertices, so buffers are set once for all draws of the command list
+    cmd_list.SetVertexBuffers(m_shared_vertex_buffers);
+    cmd_list.SetIndexBuffer(BaseBuffers::GetIndexBuffer());
+
+    const rhi::ProgramBindings* applied_program_bindings_ptr = nullptr;
+    int64_t prev_drawn_instance_index = -1;
+    for (uint32_t instance_index = begin_instance_index; instance_index < end_instance_index; ++instance_index)
+    {
+        if (!IsAsteroidDrawn(instance_index))
+            continue;
+
+        // Shared bindings are switched only between textures groups, the drawn instance is selected by start instance of the draw,
+        // which is recorded with the draw command, so consecutive draws with the same bindings must never repeat the instance
+        const uint32_t subset_index = m_mesh_subset_by_instance_index[instance_index];
+        const uint32_t group_index  = m_settings.textures_array_enabled ? 0U : m_content_state_ptr->mesh_subset_texture_indices[subset_index];
+        const rhi::ProgramBindings& program_bindings = buffer_bindings.shared_program_bindings[group_index];
+        if (applied_program_bindings_ptr != &program_bindings)
+        {
+            cmd_list.SetProgramBindings(program_bindings, rhi::ProgramBindings::ApplyBehaviorMask(rhi::ProgramBindings::ApplyBehavior::ConstantOnce));
+            applied_program_bindings_ptr = &program_bindings;
+        }
+
+        META_CHECK_GREATER(static_cast<int64_t>(instance_index), prev_drawn_instance_index);
+        prev_drawn_instance_index = instance_index;
+
+        const DrawIndexedArgs& subset_draw_args = m_subset_draw_indexed_args[subset_index];
+        cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle, subset_draw_args.index_count, subset_draw_args.first_index,
+                             static_cast<uint32_t>(subset_draw_args.base_vertex), 1U, instance_index);
+    }
+}
+
+bool AsteroidsArray::IsBeltStreamingEnabled(const Settings& settings) noexcept
+{
+    return settings.belt_pages_count > 0U && settings.belt_page_size > 0U;
+}
+
+uint32_t AsteroidsArray::GetBeltResidentPagesCount(const Settings& settings) noexcept
+{
+    return std::min(settings.belt_pages_count, 2U * settings.belt_resident_radius + 1U);
+}
+
+uint32_t AsteroidsArray::GetTotalInstanceCount(const Settings& settings) noexcept
+{
+    return IsBeltStreamingEnabled(settings)
+         ? settings.belt_pages_count * settings.belt_page_size
+         : settings.instance_count;
+}
+
+AsteroidsArray::Settings AsteroidsArray::GetCoarseContentSettings(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    Settings coarse_settings(settings);
+    coarse_settings.subdivisions_count = 1U;
+    coarse_settings.textures_count     = 1U;
+    coarse_settings.texture_dimensions = gfx::Dimensions(std::min(settings.texture_dimensions.GetWidth(),  g_coarse_texture_size),
+                                                         std::min(settings.texture_dimensions.GetHeight(), g_coarse_texture_size));
+    return coarse_settings;
+}
+
+AsteroidsArray::Settings AsteroidsArray::GetBeltAdjustedSettings(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    Settings adjusted_settings(settings);
+    if (IsBeltStreamingEnabled(settings))
+    {
+        // Instance slots with uniforms and bindings are allocated only for the resident belt pages
+        adjusted_settings.instance_count = GetBeltResidentPagesCount(settings) * settings.belt_page_size;
+    }
+    return adjusted_settings;
+}
+
+uint64_t AsteroidsArray::MemoryReport::GetMeshBytes() const noexcept
+{
+    uint64_t mesh_bytes = 0U;
+    for (const MeshLod& mesh_lod : mesh_lods)
+    {
+        mesh_bytes += mesh_lod.vertex_bytes + mesh_lod.index_bytes;
+    }
+    return mesh_bytes;
+}
+
+uint64_t AsteroidsArray::MemoryReport::GetContentStateBytes() const noexcept
+{
+    return GetMeshBytes() + textures_cpu_bytes + parameters_bytes;
+}
+
+uint64_t AsteroidsArray::MemoryReport::GetTotalBytes() const noexcept
+{
+    // Uber-mesh is counted twice, since its data is retained in content state and uploaded to GPU buffers
+    return GetContentStateBytes() + GetMeshBytes() + textures_gpu_bytes + static_buffers_bytes + staging_bytes + frame_buffers_bytes;
+}
+
+template<typename ItemType>
+static uint64_t GetVectorBytes(const std::vector<ItemType>& items)
+{
+    return static_cast<uint64_t>(items.capacity() * sizeof(ItemType));
+}
+
+static uint64_t GetBufferBytes(const rhi::Buffer& buffer)
+{
+    return buffer.IsInitialized() ? buffer.GetDataSize() : 0U;
+}
+
+AsteroidsArray::MemoryReport AsteroidsArray::GetMemoryReport(const std::vector<const AsteroidMeshBufferBindings*>& frames_bindings) const
+{
+    META_FUNCTION_TASK();
+    MemoryReport memory_report;
+
+    const UberMesh& uber_mesh = m_content_state_ptr->uber_mesh;
+    memory_report.mesh_lods.resize(uber_mesh.GetSubdivisionsCount());
+    for (uint32_t subdivision_index = 0U; subdivision_index < uber_mesh.GetSubdivisionsCount(); ++subdivision_index)
+    {
+        memory_report.mesh_lods[subdivision_index] = MemoryReport::MeshLod{ subdivision_index, 0U, 0U };
+    }
+    const auto subsets_count = static_cast<uint32_t>(uber_mesh.GetSubsetCount());
+    for (uint32_t subset_index = 0U; subset_index < subsets_count; ++subset_index)
+    {
+        const gfx::Mesh::Subset& mesh_subset = uber_mesh.GetSubsets()[subset_index];
+        MemoryReport::MeshLod&   mesh_lod    = memory_report.mesh_lods[uber_mesh.GetSubsetSubdivision(subset_index)];
+        mesh_lod.vertex_bytes += static_cast<uint64_t>(mesh_subset.vertices.count * sizeof(Asteroid::Vertex));
+        mesh_lod.index_bytes  += static_cast<uint64_t>(mesh_subset.indices.count * sizeof(gfx::Mesh::Index));
+    }
+
+    // GPU textures are RGBA8 images with generated mip-maps of all array layers
+    constexpr uint64_t texture_pixel_bytes = 4U;
+    for (const rhi::SubResources& texture_subresources : m_content_state_ptr->texture_array_subresources)
+    {
+        uint64_t mip_chain_pixels_count = 0U;
+        for (uint32_t width = m_settings.texture_dimensions.GetWidth(), height = m_settings.texture_dimensions.GetHeight();;
+             width = std::max(1U, width / 2U), height = std::max(1U, height / 2U))
+        {
+            mip_chain_pixels_count += static_cast<uint64_t>(width) * height;
+            if (width == 1U && height == 1U)
+                break;
+        }
+        memory_report.textures_gpu_bytes += static_cast<uint64_t>(texture_subresources.size()) * mip_chain_pixels_count * texture_pixel_bytes;
+        for (const rhi::SubResource& texture_subresource : texture_subresources)
+        {
+            memory_report.textures_cpu_bytes += texture_subresource.GetDataSize();
+        }
+    }
+
+    memory_report.parameters_bytes     = GetVectorBytes(m_content_state_ptr->parameters);
+    memory_report.static_buffers_bytes = GetBufferBytes(m_colors_palette_buffer)
+                                       + GetBufferBytes(m_motion_uniforms_buffer)
+                                       + GetBufferBytes(m_instance_index_buffer);
+    memory_report.staging_bytes        = GetUniformsBufferSize()
+                                       + GetVectorBytes(m_mesh_subset_by_instance_index)
+                                       + GetVectorBytes(m_asteroid_updates)
+                                       + GetVectorBytes(m_tick_states)
+                                       + GetVectorBytes(m_next_tick_states)
+                                       + GetVectorBytes(m_batch_instance_uniforms)
+                                       + GetVectorBytes(m_batch_instance_indices)
+                                       + GetVectorBytes(m_batch_instance_positions)
+                                       + GetVectorBytes(m_bounding_spheres)
+                                       + GetVectorBytes(m_draw_priorities)
+                                       + GetVectorBytes(m_subset_draw_indexed_args)
+                                       + GetVectorBytes(m_draw_indexed_args);
+
+    memory_report.frames_count = static_cast<uint32_t>(frames_bindings.size());
+    for (const AsteroidMeshBufferBindings* frame_bindings_ptr : frames_bindings)
+    {
+        META_CHECK_NOT_NULL(frame_bindings_ptr);
+        memory_report.frame_buffers_bytes    += GetBufferBytes(frame_bindings_ptr->uniforms_buffer)
+                                              + GetBufferBytes(frame_bindings_ptr->instance_uniforms_buffer);
+        memory_report.program_bindings_count += static_cast<uint32_t>(frame_bindings_ptr->program_bindings_per_instance.size()
+                                                                    + frame_bindings_ptr->program_bindings_per_subset.size()
+                                                                    + frame_bindings_ptr->shared_program_bindings.size());
+    }
+    return memory_report;
+}
+
+void AsteroidsArray::SetMeshLodScreenError(float mesh_lod_screen_error)
+{
+    META_FUNCTION_TASK();
+    m_mesh_lod_screen_error = std::clamp(mesh_lod_screen_error, g_mesh_lod_min_screen_error, g_mesh_lod_max_screen_error);
+}
+
+uint32_t AsteroidsArray::GetSubsetByInstanceIndex(uint32_t instance_index) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
     META_CHECK_LESS(instance_index, m_mesh_subset_by_instance_index.size());
     return m_mesh_subset_by_instance_index[instance_index];
 }
 
-void AsteroidsArray::UpdateAsteroidUniforms(const Asteroid::Parameters& asteroid_parameters, const hlslpp::float3& eye_position, float elapsed_radians)
+void AsteroidsArray::SetMeshLodBias(float mesh_lod_bias)
 {
     META_FUNCTION_TASK();
+    META_CHECK_GREATER(mesh_lod_bias, 0.F);
+    m_mesh_lod_bias = mesh_lod_bias;
+}
+
+float AsteroidsArray::GetMeshLodErrorScale(float screen_height, float fov_y_rad, float mesh_lod_screen_error) noexcept
+{
+    // Unit size at unit distance from eye is projected to the screen height divided by the view frustum height at unit distance
+    return screen_height / (2.F * std::tan(fov_y_rad / 2.F) * mesh_lod_screen_error);
+}
 
+AsteroidsArray::AsteroidUpdate AsteroidsArray::ComputeAsteroidUpdate(const Asteroid::Parameters& asteroid_parameters,
+                                                                     const UberMesh& uber_mesh,
+                                                                     const hlslpp::float3& eye_position,
+                                                                     float elapsed_radians,
+                                                                     float mesh_lod_error_scale,
+                                                                     bool mesh_lod_coloring_enabled)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    return ComputeAsteroidModelUpdate(asteroid_parameters, uber_mesh, GetAsteroidOrbitModelMatrix(asteroid_parameters, elapsed_radians),
+                                      eye_position, mesh_lod_error_scale, mesh_lod_coloring_enabled);
+}
+
+AsteroidsArray::AsteroidUpdate AsteroidsArray::ComputeAsteroidUpdate(const Asteroid::Parameters& asteroid_parameters,
+                                                                     const UberMesh& uber_mesh,
+                                                                     const hlslpp::float3& eye_position,
+                                                                     float elapsed_radians,
+                                                                     float mesh_lod_error_scale,
+                                                                     bool mesh_lod_coloring_enabled,
+                                                                     const hlslpp::float3& asteroid_position)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    return ComputeAsteroidModelUpdate(asteroid_parameters, uber_mesh,
+                                      GetAsteroidPerturbedModelMatrix(asteroid_parameters, elapsed_radians, asteroid_position),
+                                      eye_position, mesh_lod_error_scale, mesh_lod_coloring_enabled);
+}
+
+AsteroidsArray::AsteroidTickState AsteroidsArray::GetAsteroidTickState(const Asteroid::Parameters& asteroid_parameters, double elapsed_seconds) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    const auto  elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
     const float spin_angle_rad  = asteroid_parameters.spin_angle_rad  + asteroid_parameters.spin_speed  * elapsed_radians;
     const float orbit_angle_rad = asteroid_parameters.orbit_angle_rad - asteroid_parameters.orbit_speed * elapsed_radians;
+    const hlslpp::float4x4& scale_translate = asteroid_parameters.scale_translate_matrix;
+    return AsteroidTickState
+    {
+        .spin_rotation  = hlslpp::quaternion::rotation_axis(asteroid_parameters.spin_axis, spin_angle_rad),
+        .orbit_rotation = hlslpp::quaternion::rotation_y(orbit_angle_rad),
+        .position       = m_gravity_ptr
+                        ? m_gravity_ptr->GetPosition(asteroid_parameters.index, elapsed_seconds)
+                        : AsteroidsOrbitalIndex::GetOrbitPosition(hlslpp::float3(scale_translate._m30, scale_translate._m31, scale_translate._m32),
+                                                                  orbit_angle_rad)
+    };
+}
 
-    const hlslpp::float4x4 spin_rotation_matrix  = hlslpp::float4x4::rotation_axis(asteroid_parameters.spin_axis, spin_angle_rad);
-    const hlslpp::float4x4 orbit_rotation_matrix = hlslpp::float4x4::rotation_y(orbit_angle_rad);
+AsteroidsArray::AsteroidUpdate AsteroidsArray::GetAsteroidUpdate(const Asteroid::Parameters& asteroid_parameters, const hlslpp::float3& eye_position,
+                                                                 double elapsed_seconds) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    const auto elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+    if (!m_gravity_ptr)
+        return ComputeAsteroidUpdate(asteroid_parameters, m_content_state_ptr->uber_mesh, eye_position, elapsed_radians,
+                                     m_mesh_lod_error_scale, m_mesh_lod_coloring_enabled);
+
+    return ComputeAsteroidUpdate(asteroid_parameters, m_content_state_ptr->uber_mesh, eye_position, elapsed_radians,
+                                 m_mesh_lod_error_scale, m_mesh_lod_coloring_enabled,
+                                 m_gravity_ptr->GetPosition(asteroid_parameters.index, elapsed_seconds));
+}
 
-    const hlslpp::float4x4 model_matrix = hlslpp::mul(hlslpp::mul(spin_rotation_matrix, asteroid_parameters.scale_translate_matrix), orbit_rotation_matrix);
-    const hlslpp::float3   asteroid_position(model_matrix._m30, model_matrix._m31, model_matrix._m32);
-    const float            distance_to_eye            = hlslpp::length(eye_position - asteroid_position);
-    const float            relative_screen_size_log_2 = std::log2(asteroid_parameters.scale / std::sqrt(distance_to_eye));
+void AsteroidsArray::UpdateAsteroidUniforms(const Asteroid::Parameters& asteroid_parameters, const hlslpp::float3& eye_position, double elapsed_seconds)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    const AsteroidUpdate asteroid_update = GetAsteroidUpdate(asteroid_parameters, eye_position, elapsed_seconds);
 
-    const float    mesh_subdiv_float        = std::roundf(relative_screen_size_log_2 - m_min_mesh_lod_screen_size_log_2);
-    const uint32_t mesh_subdivision_index   = std::min(m_settings.subdivisions_count - 1, static_cast<uint32_t>(std::max(0.0F, mesh_subdiv_float)));
-    const uint32_t mesh_subset_index        = m_content_state_ptr->uber_mesh.GetSubsetIndex(asteroid_parameters.mesh_instance_index, mesh_subdivision_index);
-    const auto&   [mesh_depth_min, mesh_depth_max] = m_content_state_ptr->uber_mesh.GetSubsetDepthRange(mesh_subset_index);
-    const Asteroid::Colors& asteroid_colors = m_mesh_lod_coloring_enabled
-                                            ? Asteroid::GetAsteroidLodColors(mesh_subdivision_index)
-                                            : asteroid_parameters.colors;
+    const hlslpp::float4x4& model_matrix = asteroid_update.uniforms.model_matrix; // transposed
+    const hlslpp::float3    asteroid_position(model_matrix._m03, model_matrix._m13, model_matrix._m23);
+    UpdateBoundingSphere(asteroid_parameters, asteroid_position, asteroid_update.uniforms.depth_max);
+    UpdateDrawPriority(asteroid_parameters, asteroid_position);
+
+    m_mesh_subset_by_instance_index[asteroid_parameters.index] = asteroid_update.mesh_subset_index;
+
+    // Asteroids which are not drawn are skipped by mesh buffers draw, so their uniforms are not written until they are drawn again
+    const bool is_drawn = IsAsteroidDrawn(asteroid_parameters.index);
+    if (is_drawn)
+        SetFinalPassUniforms(asteroid_update.uniforms, asteroid_parameters.index);
+
+    if (m_settings.indirect_args_enabled)
+    {
+        // Draw argument record of every asteroid is written by the parallel update, so that draw encoding does no LOD lookups
+        DrawIndexedArgs& draw_args = m_draw_indexed_args[asteroid_parameters.index];
+        draw_args                = m_subset_draw_indexed_args[asteroid_update.mesh_subset_index];
+        draw_args.first_instance = asteroid_parameters.index;
+        draw_args.instance_count = is_drawn ? draw_args.instance_count : 0U;
+    }
+}
+
+void AsteroidsArray::UpdateBoundingSphere(const Asteroid::Parameters& asteroid_parameters, const hlslpp::float3& asteroid_position, float mesh_depth_max)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    if (!m_settings.collisions_enabled)
+        return;
+
+    META_CHECK_LESS(asteroid_parameters.index, m_bounding_spheres.size());
+    m_bounding_spheres[asteroid_parameters.index] = AsteroidCollisions::GetBoundingSphere(asteroid_parameters, asteroid_position, mesh_depth_max);
+}
+
+void AsteroidsArray::SetDrawnFraction(float drawn_fraction)
+{
+    META_FUNCTION_TASK();
+    m_drawn_fraction = std::clamp(drawn_fraction, 0.F, 1.F);
+}
+
+static uint32_t GetDrawPriorityBin(float draw_priority)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    if (!(draw_priority > 0.F))
+        return 0U;
+
+    const float bin = std::floor(std::log2(draw_priority) * static_cast<float>(g_draw_priority_bins_per_octave))
+                    + static_cast<float>(g_draw_priority_bins_count / 2U);
+    return static_cast<uint32_t>(std::clamp(bin, 0.F, static_cast<float>(g_draw_priority_bins_count - 1U)));
+}
+
+static float GetDrawPriorityBinBegin(uint32_t bin_index)
+{
+    if (!bin_index)
+        return 0.F;
+    if (bin_index >= g_draw_priority_bins_count)
+        return std::numeric_limits<float>::infinity();
+
+    return std::exp2(static_cast<float>(static_cast<int32_t>(bin_index) - static_cast<int32_t>(g_draw_priority_bins_count / 2U))
+                     / static_cast<float>(g_draw_priority_bins_per_octave));
+}
+
+void AsteroidsArray::UpdateMinDrawnPriority()
+{
+    META_FUNCTION_TASK();
+    const size_t asteroids_count = m_content_state_ptr->parameters.size();
+    if (m_draw_priorities.size() != asteroids_count)
+    {
+        // All asteroids are drawn until their priorities are evaluated on simulation step
+        m_draw_priorities.assign(asteroids_count, std::numeric_limits<float>::max());
+    }
 
-    m_mesh_subset_by_instance_index[asteroid_parameters.index] = mesh_subset_index;
+    // Draw priorities of the previous simulation step are used to select the drawn fraction of asteroids on this step
+    const auto hidden_asteroids_count = static_cast<size_t>((1.F - m_drawn_fraction) * static_cast<float>(asteroids_count));
+    if (!hidden_asteroids_count)
+    {
+        m_min_drawn_priority = 0.F;
+        return;
+    }
+    if (hidden_asteroids_count >= asteroids_count)
+    {
+        m_min_drawn_priority = std::numeric_limits<float>::infinity();
+        return;
+    }
 
-    SetFinalPassUniforms(
-        hlslpp::AsteroidUniforms
+    // Histogram of priorities is accumulated in parallel chunks, which update the shared histogram once per chunk,
+    // so that the first drawn priority is selected with precision of histogram bin without serial partial sort of all priorities
+    std::array<std::atomic<uint32_t>, g_draw_priority_bins_count> priority_histogram{};
+    ForEachParametersRange(
+        [this, &priority_histogram](uint32_t begin_index, uint32_t end_index)
         {
-            .model_matrix  = hlslpp::transpose(model_matrix),
-            .deep_color    = asteroid_colors.deep.AsVector(),
-            .shallow_color = asteroid_colors.shallow.AsVector(),
-            .depth_min     = mesh_depth_min,
-            .depth_max     = mesh_depth_max,
-            .texture_index = asteroid_parameters.texture_index
-        },
-        asteroid_parameters.index
+            ASTEROIDS_CHUNK_TASK("AsteroidsArray::UpdateMinDrawnPriority::Chunk", end_index - begin_index);
+            std::array<uint32_t, g_draw_priority_bins_count> chunk_histogram{};
+            for (uint32_t asteroid_index = begin_index; asteroid_index < end_index; ++asteroid_index)
+            {
+                chunk_histogram[GetDrawPriorityBin(m_draw_priorities[asteroid_index])]++;
+            }
+            for (uint32_t bin_index = 0U; bin_index < g_draw_priority_bins_count; ++bin_index)
+            {
+                if (chunk_histogram[bin_index])
+                    priority_histogram[bin_index].fetch_add(chunk_histogram[bin_index], std::memory_order_relaxed);
+            }
+        }
     );
+
+    // Minimum drawn priority is the bin boundary, which hides the number of asteroids closest to the requested one
+    size_t   bin_begin_hidden_count = 0U;
+    uint32_t bin_index              = 0U;
+    while (bin_begin_hidden_count + priority_histogram[bin_index].load(std::memory_order_relaxed) < hidden_asteroids_count)
+    {
+        bin_begin_hidden_count += priority_histogram[bin_index].load(std::memory_order_relaxed);
+        ++bin_index;
+    }
+    const size_t bin_end_hidden_count = bin_begin_hidden_count + priority_histogram[bin_index].load(std::memory_order_relaxed);
+    if (bin_end_hidden_count - hidden_asteroids_count < hidden_asteroids_count - bin_begin_hidden_count)
+        ++bin_index;
+
+    m_min_drawn_priority = GetDrawPriorityBinBegin(bin_index);
+}
+
+void AsteroidsArray::UpdateDrawPriority(const Asteroid::Parameters& asteroid_parameters, const hlslpp::float3& asteroid_position)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    META_CHECK_LESS(asteroid_parameters.index, m_draw_priorities.size());
+
+    // Draw priority is the asteroid size relative to distance from eye, so the smallest and farthest asteroids are dropped first
+    const float distance_to_eye = hlslpp::length(m_settings.view_camera.GetOrientation().eye - asteroid_position);
+    m_draw_priorities[asteroid_parameters.index] = asteroid_parameters.scale / distance_to_eye;
+}
+
+bool AsteroidsArray::IsAsteroidDrawn(uint32_t instance_index) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    assert(instance_index < m_draw_priorities.size());
+    return m_draw_priorities[instance_index] >= m_min_drawn_priority;
+}
+
+uint32_t AsteroidsArray::GetDrawnTrianglesCount(uint32_t instance_index, uint32_t mesh_subset_index) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    return IsAsteroidDrawn(instance_index) ? m_content_state_ptr->uber_mesh.GetSubsetTrianglesCount(mesh_subset_index) : 0U;
+}
+
+void AsteroidsArray::UpdateMeshLodScreenError()
+{
+    META_FUNCTION_TASK();
+    // Drawn triangles are counted by parallel asteroid updates of the simulation step
+    if (!m_mesh_lod_triangle_budget || !m_mesh_lod_triangles_count)
+        return;
+
+    const float triangle_budget = static_cast<float>(m_mesh_lod_triangle_budget) / (m_mesh_lod_bias * m_mesh_lod_bias);
+    const float budget_ratio    = static_cast<float>(m_mesh_lod_triangles_count) / std::max(1.F, triangle_budget);
+    if (std::abs(budget_ratio - 1.F) <= g_mesh_lod_budget_tolerance)
+        return;
+
+    // Each mesh subdivision multiplies triangles count by 4 and roughly halves geometric error,
+    // so triangles count is inversely proportional to the squared screen error, which is corrected by square root of budget ratio
+    const float screen_error_ratio = std::clamp(std::sqrt(budget_ratio), 1.F / g_mesh_lod_max_error_ratio, g_mesh_lod_max_error_ratio);
+    SetMeshLodScreenError(m_mesh_lod_screen_error * screen_error_ratio);
+}
+
+void AsteroidsArray::BuildOrbitalIndex()
+{
+    META_FUNCTION_TASK();
+
+    // Orbital index does not depend on selected mesh LODs, so bounding radius is taken by the largest depth of all mesh subdivisions
+    const UberMesh& uber_mesh = m_content_state_ptr->uber_mesh;
+    AsteroidsOrbitalIndex::MeshDepthMaxima mesh_depth_maxima(uber_mesh.GetInstanceCount(), 0.F);
+    for (uint32_t mesh_instance_index = 0U; mesh_instance_index < uber_mesh.GetInstanceCount(); ++mesh_instance_index)
+    {
+        for (uint32_t subdivision_index = 0U; subdivision_index < uber_mesh.GetSubdivisionsCount(); ++subdivision_index)
+        {
+            const uint32_t mesh_subset_index = uber_mesh.GetSubsetIndex(mesh_instance_index, subdivision_index);
+            mesh_depth_maxima[mesh_instance_index] = std::max(mesh_depth_maxima[mesh_instance_index],
+                                                              uber_mesh.GetSubsetDepthRange(mesh_subset_index).second);
+        }
+    }
+    m_orbital_index = AsteroidsOrbitalIndex(m_content_state_ptr->parameters, mesh_depth_maxima);
+}
+
+void AsteroidsArray::UpdateGravityBandBounds()
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::UpdateGravityBandBounds");
+    META_CHECK_NOT_NULL(m_gravity_ptr);
+    m_gravity_band_bounds = m_orbital_index.GetBandPerturbationBounds(m_gravity_ptr->GetPerturbationBounds());
+}
+
+AsteroidsOrbitalIndex::Perturbation AsteroidsArray::GetGravityPerturbation(double elapsed_seconds) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL(m_gravity_ptr);
+
+    // Band bounds are cached after gravity steps, so queries extend every band only by perturbations of its own asteroids
+    return AsteroidsOrbitalIndex::Perturbation{
+        .band_bounds_ptr      = &m_gravity_band_bounds,
+        .window_begin_seconds = m_gravity_ptr->GetTime(),
+        .window_end_seconds   = m_gravity_ptr->GetTime() + m_gravity_ptr->GetStepSeconds(),
+        .get_position         = [this, elapsed_seconds](uint32_t asteroid_index) { return m_gravity_ptr->GetPosition(asteroid_index, elapsed_seconds); }
+    };
+}
+
+std::optional<AsteroidsOrbitalIndex::Hit> AsteroidsArray::Pick(const AsteroidsOrbitalIndex::Ray& ray, double elapsed_seconds) const
+{
+    META_FUNCTION_TASK();
+    if (!m_gravity_ptr)
+        return m_orbital_index.Pick(ray, elapsed_seconds);
+
+    const AsteroidsOrbitalIndex::Perturbation gravity_perturbation = GetGravityPerturbation(elapsed_seconds);
+    return m_orbital_index.Pick(ray, elapsed_seconds, &gravity_perturbation);
+}
+
+AsteroidsOrbitalIndex::Indices AsteroidsArray::QueryNear(const hlslpp::float3& point, float radius, double elapsed_seconds) const
+{
+    META_FUNCTION_TASK();
+    if (!m_gravity_ptr)
+        return m_orbital_index.QueryNear(point, radius, elapsed_seconds);
+
+    const AsteroidsOrbitalIndex::Perturbation gravity_perturbation = GetGravityPerturbation(elapsed_seconds);
+    return m_orbital_index.QueryNear(point, radius, elapsed_seconds, &gravity_perturbation);
+}
+
+void AsteroidsArray::UpdateInstanceBatches()
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::UpdateInstanceBatches");
+
+    if (!m_settings.subset_batching_enabled)
+    {
+        // Shared bindings draw every asteroid separately by its instance index, so instance uniforms are stored unsorted
+        const auto instances_count = static_cast<uint32_t>(m_asteroid_updates.size());
+        m_batch_instance_uniforms.resize(instances_count);
+        m_batch_instance_positions.resize(instances_count);
+        for (uint32_t instance_index = 0U; instance_index < instances_count; ++instance_index)
+        {
+            const AsteroidUpdate& asteroid_update = m_asteroid_updates[instance_index];
+            m_mesh_subset_by_instance_index[instance_index] = asteroid_update.mesh_subset_index;
+            m_batch_instance_positions[instance_index]      = instance_index;
+            m_batch_instance_uniforms[instance_index]       = GetAsteroidInstanceUniforms(asteroid_update);
+        }
+        return;
+    }
+
+    // Counting sort of instance uniforms by mesh subset, so that instances of each subset are contiguous in structured buffer,
+    // asteroids which are not drawn with the current drawn fraction are left out of batches
+    const auto subsets_count   = static_cast<uint32_t>(m_content_state_ptr->uber_mesh.GetSubsetCount());
+    const auto instances_count = static_cast<uint32_t>(m_asteroid_updates.size());
+    std::vector<uint32_t> subset_instance_offsets(subsets_count + 1U, 0U);
+    for (uint32_t instance_index = 0U; instance_index < instances_count; ++instance_index)
+    {
+        if (IsAsteroidDrawn(instance_index))
+            subset_instance_offsets[m_asteroid_updates[instance_index].mesh_subset_index + 1U]++;
+    }
+
+    m_instance_batches.clear();
+    for (uint32_t subset_index = 0U; subset_index < subsets_count; ++subset_index)
+    {
+        const uint32_t subset_instance_count = subset_instance_offsets[subset_index + 1U];
+        subset_instance_offsets[subset_index + 1U] += subset_instance_offsets[subset_index];
+        if (subset_instance_count)
+        {
+            m_instance_batches.push_back({ subset_index, subset_instance_offsets[subset_index], subset_instance_count });
+        }
+    }
+
+    const uint32_t drawn_instances_count = subset_instance_offsets[subsets_count];
+    if (m_settings.gpu_motion_enabled)
+    {
+        m_batch_instance_indices.resize(drawn_instances_count);
+        for (uint32_t instance_index = 0U; instance_index < instances_count; ++instance_index)
+        {
+            const uint32_t mesh_subset_index = m_asteroid_updates[instance_index].mesh_subset_index;
+            m_mesh_subset_by_instance_index[instance_index] = mesh_subset_index;
+            if (IsAsteroidDrawn(instance_index))
+                m_batch_instance_indices[subset_instance_offsets[mesh_subset_index]++] = instance_index;
+        }
+        return;
+    }
+
+    m_batch_instance_uniforms.resize(drawn_instances_count);
+    m_batch_instance_positions.resize(instances_count);
+    for (uint32_t instance_index = 0U; instance_index < instances_count; ++instance_index)
+    {
+        const AsteroidUpdate& asteroid_update = m_asteroid_updates[instance_index];
+        m_mesh_subset_by_instance_index[instance_index] = asteroid_update.mesh_subset_index;
+        if (!IsAsteroidDrawn(instance_index))
+        {
+            m_batch_instance_positions[instance_index] = g_hidden_batch_position;
+            continue;
+        }
+
+        const uint32_t batch_position = subset_instance_offsets[asteroid_update.mesh_subset_index]++;
+        m_batch_instance_positions[instance_index] = batch_position;
+        m_batch_instance_uniforms[batch_position]  = GetAsteroidInstanceUniforms(asteroid_update);
+    }
+}
+
+void AsteroidsArray::UploadMotionUniforms()
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsArray::UploadMotionUniforms");
+    const Parameters& parameters = m_content_state_ptr->parameters;
+    if (parameters.empty())
+        return;
+
+    std::vector<hlslpp::AsteroidMotionUniforms> motion_uniforms(parameters.size());
+    ThreadAffinity::ForEachIndexRange(GetContext().GetParallelExecutor(), static_cast<uint32_t>(parameters.size()),
+        [&parameters, &motion_uniforms](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsArray::UploadMotionUniforms::Chunk", end_index - begin_index);
+            for (uint32_t asteroid_index = begin_index; asteroid_index < end_index; ++asteroid_index)
+            {
+                const Asteroid::Parameters& asteroid_parameters = parameters[asteroid_index];
+                motion_uniforms[asteroid_parameters.index] = GetAsteroidMotionUniforms(asteroid_parameters);
+            }
+        }
+    );
+
+    const auto motion_uniforms_data_size = static_cast<Data::Size>(motion_uniforms.size() * sizeof(hlslpp::AsteroidMotionUniforms));
+    META_CHECK_GREATER_OR_EQUAL(m_motion_uniforms_buffer.GetDataSize(), motion_uniforms_data_size);
+    m_motion_uniforms_buffer.SetData(m_render_cmd_queue, rhi::SubResource(
+        reinterpret_cast<Data::ConstRawPtr>(motion_uniforms.data()), motion_uniforms_data_size)); // NOSONAR
 }
 
 } // namespace Methane::Samples
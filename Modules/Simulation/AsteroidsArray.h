@@ -24,9 +24,15 @@ Random generated asteroids array with uber-mesh and textures ready for rendering
 #pragma once
 
 #include "Asteroid.h"
+#include "FrameTimingRecorder.h"
+#include "ThreadAffinity.h"
+#include "AsteroidCollisions.h"
+#include "AsteroidsOrbitalIndex.h"
+#include "AsteroidsGravity.h"
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/RHI/RenderState.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
 #include <Methane/Graphics/MeshBuffers.hpp>
 #include <Methane/Graphics/Mesh.h>
 #include <Methane/Graphics/Camera.h>
@@ -39,6 +45,8 @@ namespace hlslpp // NOSONAR
 }
 
 #include <taskflow/taskflow.hpp>
+#include <random>
+#include <atomic>
 
 
 namespace Methane::Graphics::Rhi
@@ -73,17 +81,51 @@ public:
         uint32_t        random_seed              = 1337U;
         float           orbit_radius_ratio       = 10.F;
         float           disc_radius_ratio        = 3.F;
-        float           mesh_lod_min_screen_size = 0.06F;
+        float           mesh_lod_screen_error    = 2.F; // maximum geometric error of selected mesh LODs projected to screen in pixels
+        uint32_t        mesh_lod_triangle_budget = 0U; // screen error is adjusted on every simulation step to hold total triangles count, fixed when zero
         float           min_asteroid_scale_ratio = 0.1F;
         float           max_asteroid_scale_ratio = 0.7F;
         bool            textures_array_enabled   = false;
         bool            depth_reversed           = false;
+        bool            subset_batching_enabled  = false; // draw all instances of each mesh subset with one instanced draw call
+        bool            indirect_args_enabled    = false; // encode draw calls from indexed draw argument records written on update
+        bool            shared_bindings_enabled  = false; // reuse shared program bindings with per-draw instance index in start instance
+        bool            balanced_draw_enabled    = false; // split parallel draws by estimated cost with dynamic chunks distribution
+        bool            gpu_motion_enabled       = false; // evaluate model matrices in vertex shader from static motion parameters, requires subset batching
+        bool            collisions_enabled       = false; // detect collisions of asteroid bounding spheres on every simulation tick
+        bool            gravity_enabled          = false; // perturb asteroid orbits by mutual gravity integrated on CPU, incompatible with GPU motion
+        float           gravity_theta            = 0.7F; // opening angle of Barnes-Hut octree nodes, smaller is more accurate
+        uint32_t        gravity_tick_rate        = 20U; // fixed gravity integration steps rate in Hz
+        uint32_t        simulation_tick_rate     = 0U; // fixed simulation rate in Hz with model matrices evaluated per update, every update is simulated when zero
+        uint32_t        belt_pages_count         = 0U; // streaming belt mode is enabled when non-zero, instance_count is ignored then
+        uint32_t        belt_page_size           = 1000U;
+        uint32_t        belt_resident_radius     = 2U; // belt pages resident on each side of the camera page
+    };
+
+    // Thread-safe progress of content generation, which may be running on background threads,
+    // cancelled generation skips remaining steps and its incomplete content state must be discarded
+    class ContentProgress
+    {
+    public:
+        explicit ContentProgress(uint32_t steps_count) noexcept : m_steps_count(steps_count) { }
+
+        void CompleteSteps(uint32_t steps_count = 1U) noexcept { m_completed_steps_count += steps_count; }
+        void Cancel() noexcept                                 { m_is_cancelled = true; }
+        [[nodiscard]] bool     IsCancelled() const noexcept    { return m_is_cancelled; }
+        [[nodiscard]] uint32_t GetStepsCount() const noexcept  { return m_steps_count; }
+        [[nodiscard]] float    GetRatio() const noexcept;
+
+    private:
+        const uint32_t        m_steps_count;
+        std::atomic<uint32_t> m_completed_steps_count{ 0U };
+        std::atomic<bool>     m_is_cancelled{ false };
     };
 
     class UberMesh : public gfx::UberMesh<Asteroid::Vertex>
     {
     public:
-        UberMesh(tf::Executor& parallel_executor, uint32_t instance_count, uint32_t subdivisions_count, uint32_t random_seed);
+        UberMesh(tf::Executor& parallel_executor, uint32_t instance_count, uint32_t subdivisions_count, uint32_t random_seed,
+                 ContentProgress* progress_ptr = nullptr);
 
         [[nodiscard]] uint32_t GetInstanceCount() const noexcept      { return m_instance_count; }
         [[nodiscard]] uint32_t GetSubdivisionsCount() const noexcept  { return m_subdivisions_count; }
@@ -91,13 +133,19 @@ public:
         [[nodiscard]] uint32_t GetSubsetIndex(uint32_t instance_index, uint32_t subdivision_index) const;
         [[nodiscard]] uint32_t GetSubsetSubdivision(uint32_t subset_index) const;
         [[nodiscard]] const Asteroid::Mesh::DepthRange& GetSubsetDepthRange(uint32_t subset_index) const;
+        [[nodiscard]] float GetSubsetGeometricError(uint32_t subset_index) const;
+        [[nodiscard]] uint32_t GetSubsetTrianglesCount(uint32_t subset_index) const;
 
     private:
-        using DepthRanges = std::vector<Asteroid::Mesh::DepthRange>;
+        using DepthRanges     = std::vector<Asteroid::Mesh::DepthRange>;
+        using GeometricErrors = std::vector<float>;
 
-        const uint32_t m_instance_count;
-        const uint32_t m_subdivisions_count;
-        DepthRanges    m_depth_ranges;
+        void AddSubdivisionMeshes(const std::vector<Asteroid::Mesh>& meshes, const GeometricErrors& geometric_errors);
+
+        const uint32_t  m_instance_count;
+        const uint32_t  m_subdivisions_count;
+        DepthRanges     m_depth_ranges;
+        GeometricErrors m_geometric_errors;
     };
 
     using Parameters               = std::vector<Asteroid::Parameters>;
@@ -105,74 +153,378 @@ public:
 
     struct ContentState : public std::enable_shared_from_this<ContentState>
     {
-        ContentState(tf::Executor& parallel_executor, const Settings& settings);
+        ContentState(tf::Executor& parallel_executor, const Settings& settings,
+                     ContentProgress* progress_ptr = nullptr);
+
+        // Incremental content state for the new settings, which reuses uber-mesh and textures of the previous state
+        // when their generation settings are unchanged and keeps parameters of the previous state asteroids
+        ContentState(tf::Executor& parallel_executor, const Settings& settings,
+                     const ContentState& prev_state, const Settings& prev_settings,
+                     ContentProgress* progress_ptr = nullptr);
+
+        // Count of content progress steps completed by content state construction
+        [[nodiscard]] static uint32_t GetGenerationStepsCount(const Settings& settings, const Settings* prev_settings_ptr = nullptr) noexcept;
+
+        [[nodiscard]] static bool IsUberMeshReusable(const Settings& prev_settings, const Settings& settings) noexcept;
+        [[nodiscard]] static bool AreTexturesReusable(const Settings& prev_settings, const Settings& settings) noexcept;
+
+        // Streaming belt mode: belt ring is divided into angular pages and only pages near the view camera are resident,
+        // returns true when resident pages have changed and parameters of the new pages were generated from per-page seeds
+        // with asteroids placed inside page sectors at the orbital phase of the given time
+        bool UpdateBeltPages(const Settings& settings, float elapsed_radians);
+
+        struct BeltPage
+        {
+            uint32_t page_index;
+            float    generation_elapsed_radians;
+            float    mean_orbit_speed; // page is generated again when its asteroids drift out of the page sector
+        };
 
         using MeshSubsetTextureIndices = std::vector<uint32_t>;
+        using BeltPages                = std::vector<BeltPage>;
 
         UberMesh                 uber_mesh;
         TextureArraySubresources texture_array_subresources;
         MeshSubsetTextureIndices mesh_subset_texture_indices;
         Parameters               parameters;
+        BeltPages                resident_belt_pages; // belt page per slot of belt_page_size asteroid instances
+        std::atomic<float>       simulated_elapsed_radians{ 0.F }; // written by asteroids array simulation, read by incremental content state
+
+    private:
+        void GenerateTextures(tf::Executor& parallel_executor, const Settings& settings, std::mt19937& rng, ContentProgress* progress_ptr);
+        void GenerateMeshSubsetTextureIndices(const Settings& settings, std::mt19937& rng);
+        void ResizeParameters(const Settings& settings, std::mt19937& rng, ContentProgress* progress_ptr);
     };
 
     struct AsteroidMeshBufferBindings : gfx::InstancedMeshBufferBindings
     {
         std::vector<rhi::IProgramArgumentBinding*> scene_uniforms_binding_ptrs;
+
+        // Instanced batching resources: per-instance uniforms structured buffer and program bindings per mesh subset,
+        // instance uniforms buffer holds only asteroid indices sorted by mesh subset in GPU motion mode
+        rhi::Buffer                                instance_uniforms_buffer;
+        std::vector<rhi::ProgramBindings>          program_bindings_per_subset;
+        std::vector<rhi::IProgramArgumentBinding*> batch_constants_binding_ptrs;
+
+        // Shared bindings resources: program bindings per textures group, which are never changed while encoding draws,
+        // since instance uniforms are read by instance index from per-instance vertex stream offset by start instance of the draw
+        std::vector<rhi::ProgramBindings>          shared_program_bindings;
+        uint32_t                                   shared_bindings_groups_count = 0U;
+    };
+
+    struct InstanceBatch
+    {
+        uint32_t mesh_subset_index;
+        uint32_t instance_offset;
+        uint32_t instance_count;
+    };
+
+    using InstanceBatches = std::vector<InstanceBatch>;
+
+    // Indexed draw arguments record with the same layout as D3D12_DRAW_INDEXED_ARGUMENTS and VkDrawIndexedIndirectCommand,
+    // first instance holds asteroid instance index used to select its program bindings
+    struct DrawIndexedArgs
+    {
+        uint32_t index_count;
+        uint32_t instance_count;
+        uint32_t first_index;
+        int32_t  base_vertex;
+        uint32_t first_instance;
+    };
+
+    using DrawIndexedArgsArray    = std::vector<DrawIndexedArgs>;
+    using CollisionEventsCallback = AsteroidCollisions::EventsCallback;
+
+    // Memory breakdown of asteroids content and rendering resources in bytes
+    struct MemoryReport
+    {
+        struct MeshLod
+        {
+            uint32_t   subdivision_index;
+            uint64_t   vertex_bytes;
+            uint64_t   index_bytes;
+        };
+
+        using MeshLods = std::vector<MeshLod>;
+
+        MeshLods   mesh_lods;                  // uber-mesh data per LOD, retained in content state and GPU buffers
+        uint64_t   textures_cpu_bytes     = 0; // texture array sub-resources retained in content state
+        uint64_t   textures_gpu_bytes     = 0; // asteroid textures with full mip-map chains
+        uint64_t   parameters_bytes       = 0; // asteroid parameters retained in content state
+        uint64_t   static_buffers_bytes   = 0; // colors palette and motion uniforms buffers
+        uint64_t   staging_bytes          = 0; // CPU-side uniforms, instance updates and draw arguments
+        uint64_t   frame_buffers_bytes    = 0; // uniforms and instance buffers of all frames
+        uint32_t   frames_count           = 0U;
+        uint32_t   program_bindings_count = 0U; // program bindings of all frames
+
+        [[nodiscard]] uint64_t GetMeshBytes() const noexcept;
+        [[nodiscard]] uint64_t GetContentStateBytes() const noexcept;
+        [[nodiscard]] uint64_t GetTotalBytes() const noexcept;
     };
 
+    struct AsteroidUpdate
+    {
+        hlslpp::AsteroidUniforms uniforms;
+        Asteroid::ColorIndices   color_indices;
+        uint32_t                 mesh_subset_index;
+    };
+
+    // Scale of mesh geometric error to the distance from eye, at which the error is projected to the given screen error in pixels:
+    // the coarsest mesh LOD is selected with geometric_error * asteroid_scale * mesh_lod_error_scale <= distance_to_eye
+    [[nodiscard]] static float GetMeshLodErrorScale(float screen_height, float fov_y_rad, float mesh_lod_screen_error) noexcept;
+
+    // Per-asteroid update kernel, which computes model matrix, mesh LOD subset and uniforms at the given time
+    [[nodiscard]] static AsteroidUpdate ComputeAsteroidUpdate(const Asteroid::Parameters& asteroid_parameters,
+                                                              const UberMesh& uber_mesh,
+                                                              const hlslpp::float3& eye_position,
+                                                              float elapsed_radians,
+                                                              float mesh_lod_error_scale,
+                                                              bool mesh_lod_coloring_enabled);
+
+    // Per-asteroid update kernel with asteroid position perturbed from its orbit, which replaces orbital translation of model matrix
+    [[nodiscard]] static AsteroidUpdate ComputeAsteroidUpdate(const Asteroid::Parameters& asteroid_parameters,
+                                                              const UberMesh& uber_mesh,
+                                                              const hlslpp::float3& eye_position,
+                                                              float elapsed_radians,
+                                                              float mesh_lod_error_scale,
+                                                              bool mesh_lod_coloring_enabled,
+                                                              const hlslpp::float3& asteroid_position);
+
     AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
                    const rhi::RenderPattern& render_pattern,
                    const Settings& settings);
 
+    // Deferred creation spreads GPU resources creation between frames: render state and mesh buffers are created by constructor,
+    // while textures are created one per call of CreateNextDeferredResource, followed by instance resources and initial uniforms
+    enum class ResourcesCreation
+    {
+        Immediate,
+        Deferred
+    };
+
     AsteroidsArray(const rhi::CommandQueue& render_cmd_queue,
                    const rhi::RenderPattern& render_pattern,
                    const Settings& settings,
-                   ContentState& state);
+                   ContentState& state,
+                   ResourcesCreation resources_creation = ResourcesCreation::Immediate);
+
+    void CreateNextDeferredResource();
+    [[nodiscard]] bool IsResident() const noexcept { return m_is_resident; }
+
+    [[nodiscard]] static bool     IsBeltStreamingEnabled(const Settings& settings) noexcept;
+    [[nodiscard]] static uint32_t GetBeltResidentPagesCount(const Settings& settings) noexcept;
+    [[nodiscard]] static uint32_t GetTotalInstanceCount(const Settings& settings) noexcept;
+    [[nodiscard]] static Settings GetBeltAdjustedSettings(const Settings& settings);
+
+    // Settings of coarse content for progressive startup: only the lowest mesh LOD and a single small placeholder texture,
+    // so mesh LOD selection is clamped to the only resident subdivision until refined content is swapped in
+    [[nodiscard]] static Settings GetCoarseContentSettings(const Settings& settings);
+
+    // In-place resize keeps render state, mesh buffers and textures, so that only uniforms and program bindings are re-created,
+    // which is possible when uber-mesh and textures are reused by the incremental content state and rendering modes are unchanged
+    [[nodiscard]] static bool IsResizable(const Settings& prev_settings, const Settings& settings) noexcept;
+    void Resize(const Settings& settings, ContentState& state);
 
     [[nodiscard]] const Settings& GetSettings() const         { return m_settings; }
     [[nodiscard]] const Ptr<ContentState>& GetState() const   { return m_content_state_ptr; }
     using BaseBuffers::GetUniformsBufferSize;
 
+    // Subset batching and shared bindings read compact instance uniforms from structured buffer instead of aligned uniforms buffer
+    [[nodiscard]] bool IsInstanceUniformsBufferUsed() const noexcept { return m_settings.subset_batching_enabled || m_settings.shared_bindings_enabled; }
+
+    // Subset batching takes precedence over shared bindings when both are enabled
+    [[nodiscard]] bool IsSharedBindingsUsed() const noexcept { return m_settings.shared_bindings_enabled && !m_settings.subset_batching_enabled; }
+
     AsteroidMeshBufferBindings CreateProgramBindings(const rhi::Buffer& constants_buffer,
                                                      const rhi::Buffer& asteroids_uniforms_buffer,
                                                      Data::Index frame_index) const;
 
+    [[nodiscard]] MemoryReport GetMemoryReport(const std::vector<const AsteroidMeshBufferBindings*>& frames_bindings) const;
+
     bool Update(double elapsed_seconds, double delta_seconds);
 
     void Draw(const rhi::RenderCommandList& cmd_list,
-              const gfx::InstancedMeshBufferBindings& buffer_bindings,
+              const AsteroidMeshBufferBindings& buffer_bindings,
               const rhi::ViewState& view_state);
 
     void DrawParallel(const rhi::ParallelRenderCommandList& parallel_cmd_list,
-                      const gfx::InstancedMeshBufferBindings& buffer_bindings,
+                      const AsteroidMeshBufferBindings& buffer_bindings,
                       const rhi::ViewState& view_state);
 
+    [[nodiscard]] const InstanceBatches&      GetInstanceBatches() const noexcept { return m_instance_batches; }
+    [[nodiscard]] const DrawIndexedArgsArray& GetDrawIndexedArgs() const noexcept { return m_draw_indexed_args; }
+    [[nodiscard]] const std::vector<double>&  GetCmdListEncodeSeconds() const noexcept { return m_cmd_list_encode_seconds; }
+
+    // Draw argument records are written by the parallel update in indirect arguments mode on any backend,
+    // while their submission with multi-draw-indirect commands is gated by backend support,
+    // otherwise the records are replayed on CPU with one indexed draw call per record
+    [[nodiscard]] static bool IsMultiDrawIndirectSupported(const rhi::RenderContext& render_context) noexcept;
+
+    // Optional recorder of update, uniforms upload and draw encoding durations, which is not owned by asteroids array
+    void SetFrameTimingRecorder(FrameTimingRecorder* frame_timing_recorder_ptr) noexcept { m_frame_timing_recorder_ptr = frame_timing_recorder_ptr; }
+
+    // Optional placement of parallel executor workers, which is not owned by asteroids array, enables node-local partitioning of asteroid updates
+    void SetThreadAffinity(const ThreadAffinity* thread_affinity_ptr) noexcept { m_thread_affinity_ptr = thread_affinity_ptr; }
+
+    // Collision events are reported after every simulated tick on the thread calling Update, when collisions detection is enabled
+    void SetCollisionEventsCallback(CollisionEventsCallback events_callback) { m_collision_events_callback = std::move(events_callback); }
+    [[nodiscard]] const AsteroidCollisions::Statistics& GetCollisionStatistics() const noexcept { return m_collisions.GetStatistics(); }
+
+    // Ray picking and proximity queries at the given simulation time use orbital index, which is rebuilt only when belt parameters are regenerated;
+    // with gravity enabled, index candidates are searched with margins of perturbation bounds of their bands and tested at perturbed positions
+    [[nodiscard]] std::optional<AsteroidsOrbitalIndex::Hit> Pick(const AsteroidsOrbitalIndex::Ray& ray, double elapsed_seconds) const;
+    [[nodiscard]] AsteroidsOrbitalIndex::Indices QueryNear(const hlslpp::float3& point, float radius, double elapsed_seconds) const;
+    [[nodiscard]] const AsteroidsOrbitalIndex& GetOrbitalIndex() const noexcept { return m_orbital_index; }
+
+    // Gravity perturbations integrator is available only when gravity is enabled in settings
+    [[nodiscard]] const AsteroidsGravity* GetGravity() const noexcept { return m_gravity_ptr.get(); }
+
     [[nodiscard]] bool IsMeshLodColoringEnabled() const             { return m_mesh_lod_coloring_enabled; }
     void SetMeshLodColoringEnabled(bool mesh_lod_coloring_enabled)  { m_mesh_lod_coloring_enabled = mesh_lod_coloring_enabled; }
 
-    [[nodiscard]] float GetMinMeshLodScreenSize() const;
-    void SetMinMeshLodScreenSize(float mesh_lod_min_screen_size);
+    // Screen error is adjusted on every simulation step to hold triangles count of selected mesh LODs within the budget, unless it is zero
+    [[nodiscard]] float    GetMeshLodScreenError() const noexcept    { return m_mesh_lod_screen_error; }
+    [[nodiscard]] uint32_t GetMeshLodTriangleBudget() const noexcept { return m_mesh_lod_triangle_budget; }
+    [[nodiscard]] uint32_t GetMeshLodTrianglesCount() const noexcept { return m_mesh_lod_triangles_count; }
+    void SetMeshLodScreenError(float mesh_lod_screen_error);
+    void SetMeshLodTriangleBudget(uint32_t mesh_lod_triangle_budget) { m_mesh_lod_triangle_budget = mesh_lod_triangle_budget; }
+
+    // LOD bias is applied on top of the screen error and triangle budget set by user: it multiplies the screen error,
+    // or divides the triangle budget by squared bias when the budget is set, since triangles count is inversely proportional to squared error
+    [[nodiscard]] float GetMeshLodBias() const noexcept { return m_mesh_lod_bias; }
+    void SetMeshLodBias(float mesh_lod_bias);
+
+    // Fraction of asteroids drawn, the smallest and farthest asteroids are dropped first without regeneration of content
+    [[nodiscard]] float GetDrawnFraction() const noexcept { return m_drawn_fraction; }
+    void SetDrawnFraction(float drawn_fraction);
 
 protected:
     // MeshBuffers overrides
     uint32_t GetSubsetByInstanceIndex(uint32_t instance_index) const override;
 
 private:
-    using MeshSubsetByInstanceIndex = std::vector<uint32_t>;
+    // Asteroid pose at simulation tick, which is interpolated to the render time between ticks,
+    // while non-uniform scale applied between spin and orbit rotations is taken from parameters
+    struct AsteroidTickState
+    {
+        hlslpp::quaternion spin_rotation;
+        hlslpp::quaternion orbit_rotation;
+        hlslpp::float3     position;
+    };
 
+    using MeshSubsetByInstanceIndex = std::vector<uint32_t>;
+    using AsteroidUpdates           = std::vector<AsteroidUpdate>;
+    using AsteroidTickStates        = std::vector<AsteroidTickState>;
+    using InstanceUniforms          = std::vector<hlslpp::AsteroidInstanceUniforms>;
+    using InstanceIndices           = std::vector<uint32_t>;
+    using BoundingSpheres           = AsteroidCollisions::BoundingSpheres;
+    using AsteroidsGravityPtr       = UniquePtr<AsteroidsGravity>;
+    using PerturbationBounds        = AsteroidsOrbitalIndex::PerturbationBounds;
+
+    AsteroidMeshBufferBindings CreateBatchProgramBindings(const rhi::Buffer& constants_buffer,
+                                                          const rhi::Buffer& asteroids_uniforms_buffer,
+                                                          Data::Index frame_index) const;
+
+    AsteroidMeshBufferBindings CreateSharedProgramBindings(const rhi::Buffer& constants_buffer,
+                                                           Data::Index frame_index) const;
+
+    [[nodiscard]] AsteroidTickState GetAsteroidTickState(const Asteroid::Parameters& asteroid_parameters,
+                                                         double elapsed_seconds) const;
+    void UpdateGravityBandBounds();
+    [[nodiscard]] AsteroidsOrbitalIndex::Perturbation GetGravityPerturbation(double elapsed_seconds) const;
+    [[nodiscard]] AsteroidUpdate GetAsteroidUpdate(const Asteroid::Parameters& asteroid_parameters,
+                                                   const hlslpp::float3& eye_position,
+                                                   double elapsed_seconds) const;
     void UpdateAsteroidUniforms(const Asteroid::Parameters& asteroid_parameters,
                                 const hlslpp::float3& eye_position,
-                                float elapsed_radians);
+                                double elapsed_seconds);
+    void UpdateBoundingSphere(const Asteroid::Parameters& asteroid_parameters,
+                              const hlslpp::float3& asteroid_position,
+                              float mesh_depth_max);
+    [[nodiscard]] uint32_t GetDrawnTrianglesCount(uint32_t instance_index, uint32_t mesh_subset_index) const;
+    void UpdateMeshLodScreenError();
+    void UpdateMinDrawnPriority();
+    void UpdateDrawPriority(const Asteroid::Parameters& asteroid_parameters,
+                            const hlslpp::float3& asteroid_position);
+    [[nodiscard]] bool IsAsteroidDrawn(uint32_t instance_index) const;
+    void BuildOrbitalIndex();
+    template<typename FuncType>
+    void ForEachParameters(const FuncType& parameters_func) const;
+    template<typename FuncType>
+    uint32_t SumForEachParameters(const FuncType& parameters_func) const;
+    template<typename RangeFuncType>
+    void ForEachParametersRange(const RangeFuncType& range_func) const;
+    void InitializeInstances();
+    bool Simulate(double elapsed_seconds);
+    void UpdateTickStates(double tick_seconds, double next_tick_seconds, bool is_next_tick);
+    void UpdateModelMatrices(float tick_ratio);
+    void UpdateInstanceBatches();
+    void UploadMotionUniforms();
+    void UploadUniforms(const AsteroidMeshBufferBindings& buffer_bindings) const;
+    [[nodiscard]] hlslpp::AsteroidBatchConstants GetBatchConstants(const InstanceBatch& instance_batch) const;
+    void DrawInstanceBatches(const rhi::RenderCommandList& cmd_list,
+                             const AsteroidMeshBufferBindings& buffer_bindings,
+                             InstanceBatches::const_iterator batches_begin,
+                             InstanceBatches::const_iterator batches_end);
+    void DrawIndexedArgsRange(const rhi::RenderCommandList& cmd_list,
+                              const AsteroidMeshBufferBindings& buffer_bindings,
+                              DrawIndexedArgsArray::const_iterator draw_args_begin,
+                              DrawIndexedArgsArray::const_iterator draw_args_end) const;
+    void DrawParallelBalanced(const rhi::ParallelRenderCommandList& parallel_cmd_list,
+                              const AsteroidMeshBufferBindings& buffer_bindings);
+    void DrawDrawnInstances(const rhi::RenderCommandList& cmd_list,
+                            const AsteroidMeshBufferBindings& buffer_bindings,
+                            uint32_t begin_instance_index,
+                            uint32_t end_instance_index) const;
+    void DrawWithSharedBindings(const rhi::RenderCommandList& cmd_list,
+                                const AsteroidMeshBufferBindings& buffer_bindings,
+                                uint32_t begin_instance_index,
+                                uint32_t end_instance_index) const;
 
     Settings                  m_settings;
     rhi::CommandQueue         m_render_cmd_queue;
     Ptr<ContentState>         m_content_state_ptr;
     Textures                  m_unique_textures;
     rhi::Sampler              m_texture_sampler;
+    rhi::Buffer               m_colors_palette_buffer;
+    rhi::Buffer               m_motion_uniforms_buffer;
+    rhi::Buffer               m_instance_index_buffer;
+    rhi::BufferSet            m_shared_vertex_buffers;
     rhi::RenderState          m_render_state;
     MeshSubsetByInstanceIndex m_mesh_subset_by_instance_index;
+    AsteroidUpdates           m_asteroid_updates;
+    AsteroidTickStates        m_tick_states;
+    AsteroidTickStates        m_next_tick_states;
+    InstanceUniforms          m_batch_instance_uniforms;
+    InstanceIndices           m_batch_instance_indices;
+    std::vector<uint32_t>     m_batch_instance_positions;
+    int64_t                   m_simulated_tick_index = -1;
+    float                     m_motion_elapsed_radians = 0.F;
+    InstanceBatches           m_instance_batches;
+    AsteroidCollisions        m_collisions;
+    BoundingSpheres           m_bounding_spheres;
+    CollisionEventsCallback   m_collision_events_callback;
+    AsteroidsOrbitalIndex     m_orbital_index;
+    AsteroidsGravityPtr       m_gravity_ptr;
+    PerturbationBounds        m_gravity_band_bounds;
+    DrawIndexedArgsArray      m_subset_draw_indexed_args;
+    DrawIndexedArgsArray      m_draw_indexed_args;
+    std::vector<float>        m_subset_draw_costs;
+    std::vector<double>       m_cmd_list_encode_seconds;
+    double                    m_encode_seconds_per_cost = 0.0;
+    FrameTimingRecorder*      m_frame_timing_recorder_ptr = nullptr;
+    const ThreadAffinity*     m_thread_affinity_ptr = nullptr;
     bool                      m_mesh_lod_coloring_enabled = false;
-    float                     m_min_mesh_lod_screen_size_log_2;
+    float                     m_mesh_lod_screen_error;
+    float                     m_mesh_lod_bias = 1.F;
+    float                     m_mesh_lod_error_scale = 0.F;
+    uint32_t                  m_mesh_lod_triangle_budget;
+    uint32_t                  m_mesh_lod_triangles_count = 0U;
+    std::vector<float>        m_draw_priorities;
+    float                     m_min_drawn_priority = 0.F;
+    float                     m_drawn_fraction = 1.F;
+    bool                      m_are_instances_initialized = false;
+    bool                      m_is_resident = false;
 };
 
 } // namespace Methane::Samples
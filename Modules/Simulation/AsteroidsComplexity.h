@@ -0,0 +1,61 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsComplexity.h
+Asteroids simulation complexity presets shared by application and benchmarks.
+
+******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+struct MutableParameters
+{
+    uint32_t instances_count;
+    uint32_t unique_mesh_count;
+    uint32_t textures_count;
+    float    scale_ratio;
+};
+
+constexpr uint32_t g_max_complexity = 9;
+inline constexpr std::array<MutableParameters, g_max_complexity+1> g_mutable_parameters{ {
+    { 1000U,  35U,   10U, 0.6F  }, // 0
+    { 2000U,  50U,   10U, 0.5F  }, // 1
+    { 3000U,  75U,   20U, 0.45F }, // 2
+    { 4000U,  100U,  20U, 0.4F  }, // 3
+    { 5000U,  200U,  30U, 0.33F }, // 4
+    { 10000U, 300U,  30U, 0.3F  }, // 5
+    { 15000U, 400U,  40U, 0.27F }, // 6
+    { 20000U, 500U,  40U, 0.23F }, // 7
+    { 35000U, 750U,  50U, 0.2F  }, // 8
+    { 50000U, 1000U, 50U, 0.17F }, // 9
+} };
+
+[[nodiscard]]
+inline const MutableParameters& GetMutableParameters(uint32_t complexity)
+{
+    return g_mutable_parameters[std::min(complexity, g_max_complexity)];
+}
+
+} // namespace Methane::Samples
@@ -0,0 +1,493 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsGravity.cpp
+Gravitational perturbation of asteroid orbits with mutual gravity of asteroids
+approximated by parallel Barnes-Hut octree rebuilt on every integration step.
+
+******************************************************************************/
+
+#include "AsteroidsGravity.h"
+#include "AsteroidsOrbitalIndex.h"
+#include "ThreadAffinity.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+#include <HotPathInstrumentation.h>
+
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Methane::Samples
+{
+
+static constexpr uint32_t g_morton_levels     = 10U; // Morton code bits per axis and maximum octree depth
+static constexpr uint32_t g_bucket_levels     = 3U;  // octree levels above buckets of bodies, which subtrees are built in parallel
+static constexpr uint32_t g_buckets_count     = 1U << (3U * g_bucket_levels);
+static constexpr uint32_t g_leaf_bodies_count = 8U;
+
+// Interleaves 10 lower bits of value with two zero bits after each bit
+[[nodiscard]]
+static uint32_t SpreadMortonBits(uint32_t value) noexcept
+{
+    value &= 0x000003FFU;
+    value  = (value | (value << 16U)) & 0x030000FFU;
+    value  = (value | (value <<  8U)) & 0x0300F00FU;
+    value  = (value | (value <<  4U)) & 0x030C30C3U;
+    value  = (value | (value <<  2U)) & 0x09249249U;
+    return value;
+}
+
+[[nodiscard]]
+static uint32_t GetMortonCell(float coordinate) noexcept
+{
+    constexpr float max_cell = static_cast<float>((1U << g_morton_levels) - 1U);
+    return static_cast<uint32_t>(std::clamp(coordinate * static_cast<float>(1U << g_morton_levels), 0.F, max_cell));
+}
+
+[[nodiscard]]
+static uint32_t GetNodeDigit(uint32_t morton_code, uint32_t level) noexcept
+{
+    return (morton_code >> (3U * (g_morton_levels - 1U - level))) & 7U;
+}
+
+// Accumulated mass and mass moments of octree node children
+struct MassMoments
+{
+    float mass     = 0.F;
+    float moment_x = 0.F;
+    float moment_y = 0.F;
+    float moment_z = 0.F;
+
+    void Add(float x, float y, float z, float point_mass) noexcept
+    {
+        mass     += point_mass;
+        moment_x += x * point_mass;
+        moment_y += y * point_mass;
+        moment_z += z * point_mass;
+    }
+
+    template<typename NodeType>
+    void ApplyTo(NodeType& node) const noexcept
+    {
+        const float inv_mass = mass > 0.F ? 1.F / mass : 0.F;
+        node.mass     = mass;
+        node.center_x = moment_x * inv_mass;
+        node.center_y = moment_y * inv_mass;
+        node.center_z = moment_z * inv_mass;
+    }
+};
+
+AsteroidsGravity::AsteroidsGravity(const Settings& settings)
+    : m_settings(settings)
+    , m_bucket_offsets(g_buckets_count + 1U, 0U)
+    , m_bucket_nodes(g_buckets_count)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(settings.tick_rate > 0U, "gravity integration tick rate must be positive");
+    META_CHECK_TRUE_DESCR(settings.max_steps_per_update > 0U, "gravity integration steps per update count must be positive");
+}
+
+void AsteroidsGravity::Reset(tf::Executor& parallel_executor, const Parameters& parameters, double elapsed_seconds)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsGravity::Reset");
+
+    const auto bodies_count    = static_cast<uint32_t>(parameters.size());
+    const auto elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+    m_time       = elapsed_seconds;
+    m_statistics = Statistics{ .bodies_count = bodies_count };
+    m_positions.resize(bodies_count);
+    m_velocities.resize(bodies_count);
+    m_accelerations.resize(bodies_count);
+    m_masses.resize(bodies_count);
+    m_orbits.resize(bodies_count);
+    m_perturbation_bounds.resize(bodies_count);
+    m_body_codes.resize(bodies_count);
+    m_sorted_bodies.resize(bodies_count);
+    m_sorted_points.resize(bodies_count);
+
+    ThreadAffinity::ForEachIndexRange(parallel_executor, GetBodiesCount(),
+        [this, &parameters, elapsed_radians](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsGravity::Reset::Chunk", end_index - begin_index);
+            for (uint32_t body_index = begin_index; body_index < end_index; ++body_index)
+            {
+                // Orbital velocity is the derivative of orbit rotation, which is the same rotation by extra right angle
+                const Asteroid::Parameters& asteroid_parameters = parameters[body_index];
+                const hlslpp::float4x4&     scale_translate     = asteroid_parameters.scale_translate_matrix;
+                const hlslpp::float3        orbit_translation(scale_translate._m30, 0.F, scale_translate._m32);
+                const auto                  orbit_height    = static_cast<float>(scale_translate._m31);
+                const float                 orbit_angle_rad = asteroid_parameters.orbit_angle_rad - asteroid_parameters.orbit_speed * elapsed_radians;
+                const float                 angular_speed   = asteroid_parameters.orbit_speed * static_cast<float>(std::numbers::pi);
+                const float                 scale           = asteroid_parameters.scale;
+
+                m_positions[body_index]  = AsteroidsOrbitalIndex::GetOrbitPosition(hlslpp::float3(scale_translate._m30, scale_translate._m31, scale_translate._m32),
+                                                                                   orbit_angle_rad);
+                m_velocities[body_index] = AsteroidsOrbitalIndex::GetOrbitPosition(orbit_translation, orbit_angle_rad + static_cast<float>(std::numbers::pi) / 2.F)
+                                         * -angular_speed;
+                m_masses[body_index]     = scale * scale * scale;
+                m_orbits[body_index]     = Orbit{ angular_speed * angular_speed, orbit_height, static_cast<float>(hlslpp::length(orbit_translation)) };
+                UpdatePerturbationBound(body_index);
+            }
+        }
+    );
+
+    BuildOctree(parallel_executor);
+    ComputeAccelerations(parallel_executor);
+}
+
+void AsteroidsGravity::Update(tf::Executor& parallel_executor, double elapsed_seconds)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsGravity::Update");
+
+    const double step_seconds = GetStepSeconds();
+    m_statistics.steps_count = 0U;
+    while (m_time + step_seconds <= elapsed_seconds && m_statistics.steps_count < m_settings.max_steps_per_update)
+    {
+        Step(parallel_executor, static_cast<float>(step_seconds));
+        m_time += step_seconds;
+        m_statistics.steps_count++;
+    }
+
+    // Integration does not catch up with updates lagging behind by more than maximum steps count, so it is slowed down instead
+    if (m_time + step_seconds <= elapsed_seconds)
+    {
+        m_time = elapsed_seconds;
+    }
+}
+
+hlslpp::float3 AsteroidsGravity::GetPosition(uint32_t asteroid_index, double elapsed_seconds) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    META_CHECK_LESS(asteroid_index, m_positions.size());
+    return m_positions[asteroid_index] + m_velocities[asteroid_index] * static_cast<float>(elapsed_seconds - m_time);
+}
+
+void AsteroidsGravity::Step(tf::Executor& parallel_executor, float step_seconds)
+{
+    META_FUNCTION_TASK();
+    const float half_step_seconds = step_seconds / 2.F;
+
+    // Leapfrog kick-drift-kick integration keeps orbits stable over long time unlike explicit Euler integration
+    ThreadAffinity::ForEachIndexRange(parallel_executor, GetBodiesCount(),
+        [this, step_seconds, half_step_seconds](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsGravity::Drift::Chunk", end_index - begin_index);
+            for (uint32_t body_index = begin_index; body_index < end_index; ++body_index)
+            {
+                m_velocities[body_index] += m_accelerations[body_index] * half_step_seconds;
+                m_positions[body_index]  += m_velocities[body_index] * step_seconds;
+            }
+        }
+    );
+
+    BuildOctree(parallel_executor);
+    ComputeAccelerations(parallel_executor);
+
+    ThreadAffinity::ForEachIndexRange(parallel_executor, GetBodiesCount(),
+        [this, half_step_seconds](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsGravity::Kick::Chunk", end_index - begin_index);
+            for (uint32_t body_index = begin_index; body_index < end_index; ++body_index)
+            {
+                m_velocities[body_index] += m_accelerations[body_index] * half_step_seconds;
+                UpdatePerturbationBound(body_index);
+            }
+        }
+    );
+}
+
+void AsteroidsGravity::UpdatePerturbationBound(uint32_t body_index)
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    const hlslpp::float3& position       = m_positions[body_index];
+    const hlslpp::float3& velocity       = m_velocities[body_index];
+    const Orbit&          orbit          = m_orbits[body_index];
+    const auto            window_seconds = static_cast<float>(GetStepSeconds());
+
+    // Extrapolated position moves along the segment during the window, so its height and distance from orbit axis are extreme
+    // at the segment ends, except the minimum distance from axis, which is reached at the segment point closest to the axis
+    const auto  begin_x       = static_cast<float>(position.x);
+    const auto  begin_z       = static_cast<float>(position.z);
+    const float delta_x       = static_cast<float>(velocity.x) * window_seconds;
+    const float delta_z       = static_cast<float>(velocity.z) * window_seconds;
+    const float delta_sq      = delta_x * delta_x + delta_z * delta_z;
+    const float closest_ratio = delta_sq > 0.F ? std::clamp(-(begin_x * delta_x + begin_z * delta_z) / delta_sq, 0.F, 1.F) : 0.F;
+    const float begin_radius  = std::hypot(begin_x, begin_z);
+    const float end_radius    = std::hypot(begin_x + delta_x, begin_z + delta_z);
+    const float min_radius    = std::hypot(begin_x + delta_x * closest_ratio, begin_z + delta_z * closest_ratio);
+    const float begin_height  = static_cast<float>(position.y) - orbit.height;
+    const float end_height    = begin_height + static_cast<float>(velocity.y) * window_seconds;
+    const float radius_offset = std::max({ std::abs(begin_radius - orbit.radius), std::abs(end_radius - orbit.radius), orbit.radius - min_radius });
+    const float height_offset = std::max(std::abs(begin_height), std::abs(end_height));
+
+    m_perturbation_bounds[body_index] = AsteroidsOrbitalIndex::PerturbationBound{
+        .distance = std::hypot(radius_offset, height_offset),
+        .speed    = static_cast<float>(hlslpp::length(velocity))
+    };
+}
+
+void AsteroidsGravity::BuildOctree(tf::Executor& parallel_executor)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsGravity::BuildOctree");
+
+    m_nodes.clear();
+    m_statistics.nodes_count = 0U;
+    if (m_positions.empty())
+        return;
+
+    hlslpp::float3 bounds_min = m_positions.front();
+    hlslpp::float3 bounds_max = m_positions.front();
+    for (const hlslpp::float3& position : m_positions)
+    {
+        bounds_min = hlslpp::min(bounds_min, position);
+        bounds_max = hlslpp::max(bounds_max, position);
+    }
+
+    // Octree cube is slightly enlarged, so that positions on the upper bounds are quantized to the last Morton cell
+    const hlslpp::float3 bounds_size(bounds_max - bounds_min);
+    m_octree_origin = bounds_min;
+    m_octree_size   = std::max({ static_cast<float>(bounds_size.x), static_cast<float>(bounds_size.y), static_cast<float>(bounds_size.z), 1E-3F }) * 1.0001F;
+    m_statistics.octree_size = m_octree_size;
+
+    ThreadAffinity::ForEachIndexRange(parallel_executor, GetBodiesCount(),
+        [this](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsGravity::MortonCodes::Chunk", end_index - begin_index);
+            const float inv_octree_size = 1.F / m_octree_size;
+            for (uint32_t body_index = begin_index; body_index < end_index; ++body_index)
+            {
+                const hlslpp::float3 relative_position((m_positions[body_index] - m_octree_origin) * inv_octree_size);
+                m_body_codes[body_index] = (SpreadMortonBits(GetMortonCell(relative_position.x)) << 2U)
+                                         | (SpreadMortonBits(GetMortonCell(relative_position.y)) << 1U)
+                                         |  SpreadMortonBits(GetMortonCell(relative_position.z));
+            }
+        }
+    );
+
+    // Counting sort of bodies by octree bucket, which is the prefix of Morton code
+    constexpr uint32_t bucket_code_shift = 3U * (g_morton_levels - g_bucket_levels);
+    std::fill(m_bucket_offsets.begin(), m_bucket_offsets.end(), 0U);
+    for (const uint32_t body_code : m_body_codes)
+    {
+        m_bucket_offsets[(body_code >> bucket_code_shift) + 1U]++;
+    }
+    for (uint32_t bucket_index = 0U; bucket_index < g_buckets_count; ++bucket_index)
+    {
+        m_bucket_offsets[bucket_index + 1U] += m_bucket_offsets[bucket_index];
+    }
+    std::vector<uint32_t> bucket_positions(m_bucket_offsets.begin(), m_bucket_offsets.end() - 1);
+    for (uint32_t body_index = 0U; body_index < m_body_codes.size(); ++body_index)
+    {
+        const uint32_t body_code = m_body_codes[body_index];
+        m_sorted_bodies[bucket_positions[body_code >> bucket_code_shift]++] = BodyKey(body_code, body_index);
+    }
+
+    // Bodies of every bucket are sorted by Morton code and its octree subtree is built in parallel with other buckets
+    tf::Taskflow build_task_flow;
+    build_task_flow.for_each_index(0U, g_buckets_count, 1U,
+        [this](const uint32_t bucket_index)
+        {
+            const uint32_t bodies_begin = m_bucket_offsets[bucket_index];
+            const uint32_t bodies_end   = m_bucket_offsets[bucket_index + 1U];
+            Nodes&         bucket_nodes = m_bucket_nodes[bucket_index];
+            bucket_nodes.clear();
+            if (bodies_begin == bodies_end)
+                return;
+
+            ASTEROIDS_CHUNK_TASK("AsteroidsGravity::BuildOctree::Bucket", bodies_end - bodies_begin);
+            std::sort(m_sorted_bodies.begin() + bodies_begin, m_sorted_bodies.begin() + bodies_end);
+            for (uint32_t sorted_index = bodies_begin; sorted_index < bodies_end; ++sorted_index)
+            {
+                const uint32_t body_index = m_sorted_bodies[sorted_index].second;
+                m_sorted_points[sorted_index] = hlslpp::float4(m_positions[body_index], m_masses[body_index]);
+            }
+            BuildNode(bucket_nodes, bodies_begin, bodies_end, g_bucket_levels);
+        }
+    );
+    parallel_executor.run(build_task_flow).get();
+
+    AppendTopLevelNode(0U, 0U);
+    m_statistics.nodes_count = static_cast<uint32_t>(m_nodes.size());
+}
+
+uint32_t AsteroidsGravity::BuildNode(Nodes& nodes, uint32_t bodies_begin, uint32_t bodies_end, uint32_t level) const
+{
+    const auto node_index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(Node{ .size = std::ldexp(m_octree_size, -static_cast<int>(level)) });
+
+    MassMoments mass_moments;
+    if (bodies_end - bodies_begin <= g_leaf_bodies_count || level == g_morton_levels)
+    {
+        for (uint32_t sorted_index = bodies_begin; sorted_index < bodies_end; ++sorted_index)
+        {
+            const hlslpp::float4& point = m_sorted_points[sorted_index];
+            mass_moments.Add(static_cast<float>(point.x), static_cast<float>(point.y), static_cast<float>(point.z), static_cast<float>(point.w));
+        }
+        nodes[node_index].bodies_begin = bodies_begin;
+        nodes[node_index].bodies_end   = bodies_end;
+    }
+    else
+    {
+        // Bodies of every child node are contiguous in sorted range, since they share the child digit of Morton code
+        for (uint32_t child_begin = bodies_begin; child_begin < bodies_end;)
+        {
+            const uint32_t child_digit  = GetNodeDigit(m_sorted_bodies[child_begin].first, level);
+            const auto     child_end_it = std::partition_point(m_sorted_bodies.begin() + child_begin, m_sorted_bodies.begin() + bodies_end,
+                                                               [child_digit, level](const BodyKey& body_key)
+                                                               { return GetNodeDigit(body_key.first, level) == child_digit; });
+            const auto     child_end    = static_cast<uint32_t>(child_end_it - m_sorted_bodies.begin());
+            const Node&    child_node   = nodes[BuildNode(nodes, child_begin, child_end, level + 1U)];
+            mass_moments.Add(child_node.center_x, child_node.center_y, child_node.center_z, child_node.mass);
+            child_begin = child_end;
+        }
+    }
+
+    Node& node = nodes[node_index];
+    mass_moments.ApplyTo(node);
+    node.next_index = static_cast<uint32_t>(nodes.size());
+    return node_index;
+}
+
+bool AsteroidsGravity::AppendTopLevelNode(uint32_t level, uint32_t bucket_begin)
+{
+    const uint32_t level_buckets_count = 1U << (3U * (g_bucket_levels - level));
+    if (m_bucket_offsets[bucket_begin] == m_bucket_offsets[bucket_begin + level_buckets_count])
+        return false;
+
+    if (level == g_bucket_levels)
+    {
+        // Bucket subtree is appended in depth-first order with next indices offset by its position in octree
+        const auto subtree_offset = static_cast<uint32_t>(m_nodes.size());
+        for (Node node : m_bucket_nodes[bucket_begin])
+        {
+            node.next_index += subtree_offset;
+            m_nodes.push_back(node);
+        }
+        return true;
+    }
+
+    const auto node_index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back(Node{ .size = std::ldexp(m_octree_size, -static_cast<int>(level)) });
+
+    MassMoments mass_moments;
+    const uint32_t child_buckets_count = level_buckets_count / 8U;
+    for (uint32_t child_digit = 0U; child_digit < 8U; ++child_digit)
+    {
+        const auto child_index = static_cast<uint32_t>(m_nodes.size());
+        if (!AppendTopLevelNode(level + 1U, bucket_begin + child_digit * child_buckets_count))
+            continue;
+
+        const Node& child_node = m_nodes[child_index];
+        mass_moments.Add(child_node.center_x, child_node.center_y, child_node.center_z, child_node.mass);
+    }
+
+    Node& node = m_nodes[node_index];
+    mass_moments.ApplyTo(node);
+    node.next_index = static_cast<uint32_t>(m_nodes.size());
+    return true;
+}
+
+void AsteroidsGravity::ComputeAccelerations(tf::Executor& parallel_executor)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsGravity::ComputeAccelerations");
+
+    // Bodies are processed in Morton order, so that neighbour bodies traverse the same octree nodes in cache
+    ThreadAffinity::ForEachIndexRange(parallel_executor, GetBodiesCount(),
+        [this](uint32_t begin_index, uint32_t end_index)
+        {
+            ASTEROIDS_CHUNK_TASK("AsteroidsGravity::ComputeAccelerations::Chunk", end_index - begin_index);
+            for (uint32_t sorted_index = begin_index; sorted_index < end_index; ++sorted_index)
+            {
+                const uint32_t        body_index = m_sorted_bodies[sorted_index].second;
+                const hlslpp::float3& position   = m_positions[body_index];
+                const Orbit&          orbit      = m_orbits[body_index];
+                const hlslpp::float3  orbit_offset(position.x, static_cast<float>(position.y) - orbit.height, position.z);
+                m_accelerations[body_index] = GetGravityAcceleration(position) - orbit_offset * orbit.angular_speed_sq;
+            }
+        }
+    );
+}
+
+hlslpp::float3 AsteroidsGravity::GetGravityAcceleration(const hlslpp::float3& position) const
+{
+    ASTEROIDS_HOT_FUNCTION_TASK();
+    const auto  position_x   = static_cast<float>(position.x);
+    const auto  position_y   = static_cast<float>(position.y);
+    const auto  position_z   = static_cast<float>(position.z);
+    const float theta_sq     = m_settings.theta * m_settings.theta;
+    const float softening_sq = m_settings.softening_length * m_settings.softening_length;
+
+    // Softened gravity of the body itself is zero, so it does not have to be excluded from leaf nodes
+    float acceleration_x = 0.F;
+    float acceleration_y = 0.F;
+    float acceleration_z = 0.F;
+    const auto add_point_gravity = [&](float offset_x, float offset_y, float offset_z, float distance_sq, float mass)
+    {
+        const float inv_distance = 1.F / std::sqrt(distance_sq + softening_sq);
+        const float factor       = mass * inv_distance * inv_distance * inv_distance;
+        acceleration_x += offset_x * factor;
+        acceleration_y += offset_y * factor;
+        acceleration_z += offset_z * factor;
+    };
+
+    const auto nodes_count = static_cast<uint32_t>(m_nodes.size());
+    for (uint32_t node_index = 0U; node_index < nodes_count;)
+    {
+        // Node is approximated with its center of mass when it is seen at angle smaller than theta, otherwise its children are visited
+        const Node& node        = m_nodes[node_index];
+        const float offset_x    = node.center_x - position_x;
+        const float offset_y    = node.center_y - position_y;
+        const float offset_z    = node.center_z - position_z;
+        const float distance_sq = offset_x * offset_x + offset_y * offset_y + offset_z * offset_z;
+        if (node.size * node.size < theta_sq * distance_sq)
+        {
+            add_point_gravity(offset_x, offset_y, offset_z, distance_sq, node.mass);
+            node_index = node.next_index;
+            continue;
+        }
+
+        if (node.bodies_begin == node.bodies_end)
+        {
+            node_index++;
+            continue;
+        }
+
+        for (uint32_t sorted_index = node.bodies_begin; sorted_index < node.bodies_end; ++sorted_index)
+        {
+            const hlslpp::float4& point          = m_sorted_points[sorted_index];
+            const float           point_offset_x = static_cast<float>(point.x) - position_x;
+            const float           point_offset_y = static_cast<float>(point.y) - position_y;
+            const float           point_offset_z = static_cast<float>(point.z) - position_z;
+            add_point_gravity(point_offset_x, point_offset_y, point_offset_z,
+                              point_offset_x * point_offset_x + point_offset_y * point_offset_y + point_offset_z * point_offset_z,
+                              static_cast<float>(point.w));
+        }
+        node_index = node.next_index;
+    }
+
+    return hlslpp::float3(acceleration_x, acceleration_y, acceleration_z) * m_settings.gravity_constant;
+}
+
+} // namespace Methane::Samples
@@ -0,0 +1,141 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsGravity.h
+Gravitational perturbation of asteroid orbits with mutual gravity of asteroids
+approximated by parallel Barnes-Hut octree rebuilt on every integration step.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Asteroid.h"
+#include "AsteroidsOrbitalIndex.h"
+
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+class AsteroidsGravity
+{
+public:
+    struct Settings
+    {
+        float    theta                = 0.7F;   // opening angle of octree nodes: 0 - exact all-pairs sum, larger is faster and less accurate
+        uint32_t tick_rate            = 20U;    // fixed integration steps rate in Hz
+        uint32_t max_steps_per_update = 4U;     // integration time is slowed down when update lags behind by more steps
+        float    gravity_constant     = 2E-6F;  // mutual gravity of asteroids with mass of unit density volume
+        float    softening_length     = 1.F;    // distance added to avoid singular accelerations of close asteroids
+    };
+
+    struct Statistics
+    {
+        uint32_t bodies_count = 0U;
+        uint32_t nodes_count  = 0U;
+        uint32_t steps_count  = 0U; // integration steps done by the last update
+        float    octree_size  = 0.F;
+    };
+
+    using Parameters         = std::vector<Asteroid::Parameters>;
+    using Positions          = std::vector<hlslpp::float3>;
+    using PerturbationBounds = AsteroidsOrbitalIndex::PerturbationBounds;
+
+    explicit AsteroidsGravity(const Settings& settings);
+
+    // Asteroids are placed on their unperturbed orbits with orbital velocities at the given time
+    void Reset(tf::Executor& parallel_executor, const Parameters& parameters, double elapsed_seconds);
+
+    // Bodies are integrated with fixed steps of the tick rate up to the given time using leapfrog scheme;
+    // every step rebuilds octree of asteroid positions, so that accelerations are computed with O(n log n) cost
+    void Update(tf::Executor& parallel_executor, double elapsed_seconds);
+
+    // Position of asteroid at the given time is extrapolated from the last integrated step
+    [[nodiscard]] hlslpp::float3 GetPosition(uint32_t asteroid_index, double elapsed_seconds) const;
+
+    // Perturbation bounds of asteroids are recorded by every integration step for extrapolation window
+    // from the integrated time to the next step, so that queries do not scan all positions to find them
+    [[nodiscard]] const PerturbationBounds& GetPerturbationBounds() const noexcept { return m_perturbation_bounds; }
+
+    [[nodiscard]] const Settings&   GetSettings() const noexcept      { return m_settings; }
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept    { return m_statistics; }
+    [[nodiscard]] const Positions&  GetPositions() const noexcept     { return m_positions; }
+    [[nodiscard]] const Positions&  GetAccelerations() const noexcept { return m_accelerations; }
+    [[nodiscard]] double            GetTime() const noexcept          { return m_time; }
+    [[nodiscard]] double            GetStepSeconds() const noexcept   { return 1.0 / static_cast<double>(m_settings.tick_rate); }
+
+private:
+    // Octree node in depth-first order: children follow their parent and next index skips the whole subtree
+    struct Node
+    {
+        float    center_x     = 0.F; // center of mass
+        float    center_y     = 0.F;
+        float    center_z     = 0.F;
+        float    mass         = 0.F;
+        float    size         = 0.F; // edge length of node cube
+        uint32_t next_index   = 0U;
+        uint32_t bodies_begin = 0U;  // range of sorted bodies in leaf node, empty in internal nodes
+        uint32_t bodies_end   = 0U;
+    };
+
+    // Planet gravity is modelled per asteroid as acceleration towards its unperturbed orbit
+    // with angular speed of the orbit, so that unperturbed asteroids move exactly as in orbital motion
+    struct Orbit
+    {
+        float angular_speed_sq;
+        float height;
+        float radius;
+    };
+
+    using Nodes   = std::vector<Node>;
+    using BodyKey = std::pair<uint32_t, uint32_t>; // Morton code and body index
+
+    void Step(tf::Executor& parallel_executor, float step_seconds);
+    void BuildOctree(tf::Executor& parallel_executor);
+    void ComputeAccelerations(tf::Executor& parallel_executor);
+    void UpdatePerturbationBound(uint32_t body_index);
+    uint32_t BuildNode(Nodes& nodes, uint32_t bodies_begin, uint32_t bodies_end, uint32_t level) const;
+    bool AppendTopLevelNode(uint32_t level, uint32_t bucket_begin);
+    [[nodiscard]] hlslpp::float3 GetGravityAcceleration(const hlslpp::float3& position) const;
+
+    [[nodiscard]] uint32_t GetBodiesCount() const noexcept { return static_cast<uint32_t>(m_positions.size()); }
+
+    Settings                    m_settings;
+    Statistics                  m_statistics;
+    double                      m_time = 0.0;
+    Positions                   m_positions;
+    Positions                   m_velocities;
+    Positions                   m_accelerations;
+    std::vector<float>          m_masses;
+    std::vector<Orbit>          m_orbits;
+    PerturbationBounds          m_perturbation_bounds;
+    std::vector<uint32_t>       m_body_codes;
+    std::vector<BodyKey>        m_sorted_bodies;
+    std::vector<hlslpp::float4> m_sorted_points; // position in xyz and mass in w of sorted bodies
+    std::vector<uint32_t>       m_bucket_offsets;
+    std::vector<Nodes>          m_bucket_nodes;  // subtree nodes of octree top level buckets are kept between steps
+    Nodes                       m_nodes;
+    hlslpp::float3              m_octree_origin{ 0.F, 0.F, 0.F };
+    float                       m_octree_size = 0.F;
+};
+
+} // namespace Methane::Samples
@@ -0,0 +1,292 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsOrbitalIndex.cpp
+Time-invariant index of asteroid orbits for ray picking and proximity queries
+at arbitrary time without rebuilding as asteroids move.
+
+******************************************************************************/
+
+#include "AsteroidsOrbitalIndex.h"
+#include "AsteroidCollisions.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <cmath>
+#include <numbers>
+
+namespace Methane::Samples
+{
+
+static constexpr uint32_t g_band_entries_count = 64U;
+static constexpr float    g_infinity           = std::numeric_limits<float>::infinity();
+
+struct RayRange
+{
+    float begin;
+    float end;
+};
+
+// Range of ray parameter where ray is inside of the infinite cylinder with the given radius around Y axis
+[[nodiscard]]
+static std::optional<RayRange> GetCylinderRayRange(const hlslpp::float3& origin, const hlslpp::float3& direction, float cylinder_radius)
+{
+    const auto  origin_x    = static_cast<float>(origin.x);
+    const auto  origin_z    = static_cast<float>(origin.z);
+    const auto  direction_x = static_cast<float>(direction.x);
+    const auto  direction_z = static_cast<float>(direction.z);
+    const float a           = direction_x * direction_x + direction_z * direction_z;
+    const float half_b      = origin_x * direction_x + origin_z * direction_z;
+    const float c           = origin_x * origin_x + origin_z * origin_z - cylinder_radius * cylinder_radius;
+    if (a <= std::numeric_limits<float>::epsilon())
+        return c <= 0.F ? std::optional<RayRange>(RayRange{ -g_infinity, g_infinity }) : std::nullopt;
+
+    const float discriminant = half_b * half_b - a * c;
+    if (discriminant < 0.F)
+        return std::nullopt;
+
+    const float discriminant_sqrt = std::sqrt(discriminant);
+    return RayRange{ (-half_b - discriminant_sqrt) / a, (-half_b + discriminant_sqrt) / a };
+}
+
+[[nodiscard]]
+static float GetRayHeight(float origin_y, float direction_y, float ray_parameter) noexcept
+{
+    if (!std::isinf(ray_parameter))
+        return origin_y + ray_parameter * direction_y;
+
+    return direction_y == 0.F ? origin_y : std::copysign(g_infinity, direction_y * ray_parameter);
+}
+
+hlslpp::float3 AsteroidsOrbitalIndex::GetOrbitPosition(const hlslpp::float3& translation, float orbit_angle_rad)
+{
+    return hlslpp::float3(hlslpp::mul(hlslpp::float4(translation, 1.F), hlslpp::float4x4::rotation_y(orbit_angle_rad)).xyz);
+}
+
+AsteroidsOrbitalIndex::AsteroidsOrbitalIndex(const Parameters& parameters, const MeshDepthMaxima& mesh_depth_maxima)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("AsteroidsOrbitalIndex::AsteroidsOrbitalIndex");
+
+    std::vector<std::pair<float, Entry>> radius_entries;
+    radius_entries.reserve(parameters.size());
+    for (const Asteroid::Parameters& asteroid_parameters : parameters)
+    {
+        META_CHECK_LESS(asteroid_parameters.mesh_instance_index, mesh_depth_maxima.size());
+        const hlslpp::float4x4& scale_translate = asteroid_parameters.scale_translate_matrix;
+        const auto              translation_x   = static_cast<float>(scale_translate._m30);
+        const auto              translation_z   = static_cast<float>(scale_translate._m32);
+        radius_entries.emplace_back(std::sqrt(translation_x * translation_x + translation_z * translation_z), Entry{
+            .orbit_height    = static_cast<float>(scale_translate._m31),
+            .translation_x   = translation_x,
+            .translation_z   = translation_z,
+            .orbit_angle_rad = asteroid_parameters.orbit_angle_rad,
+            .orbit_speed     = asteroid_parameters.orbit_speed,
+            .bounding_radius = AsteroidCollisions::GetBoundingRadius(asteroid_parameters, mesh_depth_maxima[asteroid_parameters.mesh_instance_index]),
+            .asteroid_index  = asteroid_parameters.index
+        });
+    }
+
+    // Asteroids are split in bands of equal count by orbit radius, so that bands are thin where orbits are dense
+    std::sort(radius_entries.begin(), radius_entries.end(),
+              [](const auto& left, const auto& right) { return left.first < right.first; });
+
+    const auto entries_count = static_cast<uint32_t>(radius_entries.size());
+    m_entries.reserve(entries_count);
+    m_bands.reserve((entries_count + g_band_entries_count - 1U) / g_band_entries_count);
+    for (uint32_t band_begin = 0U; band_begin < entries_count; band_begin += g_band_entries_count)
+    {
+        const uint32_t band_end = std::min(band_begin + g_band_entries_count, entries_count);
+        std::sort(radius_entries.begin() + band_begin, radius_entries.begin() + band_end,
+                  [](const auto& left, const auto& right) { return left.second.orbit_height < right.second.orbit_height; });
+
+        Band band{ g_infinity, -g_infinity, 0.F, band_begin, band_end };
+        for (uint32_t entry_index = band_begin; entry_index < band_end; ++entry_index)
+        {
+            const auto& [orbit_radius, entry] = radius_entries[entry_index];
+            band.orbit_radius_min    = std::min(band.orbit_radius_min, orbit_radius);
+            band.orbit_radius_max    = std::max(band.orbit_radius_max, orbit_radius);
+            band.bounding_radius_max = std::max(band.bounding_radius_max, entry.bounding_radius);
+            m_entries.push_back(entry);
+        }
+        m_bands.push_back(band);
+    }
+}
+
+float AsteroidsOrbitalIndex::Perturbation::GetBandMargin(uint32_t band_index, double elapsed_seconds) const
+{
+    META_CHECK_NOT_NULL(band_bounds_ptr);
+    META_CHECK_LESS(band_index, band_bounds_ptr->size());
+    const PerturbationBound& band_bound      = (*band_bounds_ptr)[band_index];
+    const double             outside_seconds = std::max({ window_begin_seconds - elapsed_seconds, elapsed_seconds - window_end_seconds, 0.0 });
+    return band_bound.distance + band_bound.speed * static_cast<float>(outside_seconds);
+}
+
+AsteroidsOrbitalIndex::PerturbationBounds AsteroidsOrbitalIndex::GetBandPerturbationBounds(const PerturbationBounds& asteroid_bounds) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL(asteroid_bounds.size(), m_entries.size());
+
+    PerturbationBounds band_bounds(m_bands.size());
+    for (uint32_t band_index = 0U; band_index < GetBandsCount(); ++band_index)
+    {
+        const Band&        band       = m_bands[band_index];
+        PerturbationBound& band_bound = band_bounds[band_index];
+        for (uint32_t entry_index = band.entries_begin; entry_index < band.entries_end; ++entry_index)
+        {
+            const PerturbationBound& asteroid_bound = asteroid_bounds[m_entries[entry_index].asteroid_index];
+            band_bound.distance = std::max(band_bound.distance, asteroid_bound.distance);
+            band_bound.speed    = std::max(band_bound.speed, asteroid_bound.speed);
+        }
+    }
+    return band_bounds;
+}
+
+hlslpp::float3 AsteroidsOrbitalIndex::GetEntryPosition(const Entry& entry, float elapsed_radians, const Perturbation* perturbation_ptr)
+{
+    if (perturbation_ptr)
+        return perturbation_ptr->get_position(entry.asteroid_index);
+
+    return GetOrbitPosition(hlslpp::float3(entry.translation_x, entry.orbit_height, entry.translation_z),
+                            entry.orbit_angle_rad - entry.orbit_speed * elapsed_radians);
+}
+
+template<typename EntryFuncType>
+void AsteroidsOrbitalIndex::ForEachBandEntryInHeightRange(const Band& band, float height_min, float height_max, const EntryFuncType& entry_func) const
+{
+    const auto band_begin_it = m_entries.begin() + band.entries_begin;
+    const auto band_end_it   = m_entries.begin() + band.entries_end;
+    for (auto entry_it = std::lower_bound(band_begin_it, band_end_it, height_min,
+                                          [](const Entry& entry, float height) { return entry.orbit_height < height; });
+         entry_it != band_end_it && entry_it->orbit_height <= height_max;
+         ++entry_it)
+    {
+        entry_func(*entry_it);
+    }
+}
+
+std::optional<AsteroidsOrbitalIndex::Hit> AsteroidsOrbitalIndex::Pick(const Ray& ray, double elapsed_seconds, const Perturbation* perturbation_ptr) const
+{
+    META_FUNCTION_TASK();
+    const hlslpp::float3 direction       = hlslpp::normalize(ray.direction);
+    const auto           origin_y        = static_cast<float>(ray.origin.y);
+    const auto           direction_y     = static_cast<float>(direction.y);
+    const auto           elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+
+    std::optional<Hit> nearest_hit;
+    for (uint32_t band_index = 0U; band_index < GetBandsCount(); ++band_index)
+    {
+        const Band&                   band        = m_bands[band_index];
+        const float                   band_margin = band.bounding_radius_max
+                                                  + (perturbation_ptr ? perturbation_ptr->GetBandMargin(band_index, elapsed_seconds) : 0.F);
+        const std::optional<RayRange> outer_range = GetCylinderRayRange(ray.origin, direction, band.orbit_radius_max + band_margin);
+        if (!outer_range)
+            continue;
+
+        // Ray ranges inside of the band annulus are the outer cylinder range without the inner cylinder range
+        const float                   inner_radius = band.orbit_radius_min - band_margin;
+        const std::optional<RayRange> inner_range  = inner_radius > 0.F
+                                                   ? GetCylinderRayRange(ray.origin, direction, inner_radius)
+                                                   : std::nullopt;
+        std::array<RayRange, 2> band_ranges{ *outer_range, RayRange{ g_infinity, -g_infinity } };
+        if (inner_range)
+        {
+            band_ranges[0] = RayRange{ outer_range->begin, std::min(outer_range->end, inner_range->begin) };
+            band_ranges[1] = RayRange{ std::max(outer_range->begin, inner_range->end), outer_range->end };
+        }
+
+        // Only asteroids hit closer than the nearest hit found so far are searched
+        float height_min = g_infinity;
+        float height_max = -g_infinity;
+        for (RayRange band_range : band_ranges)
+        {
+            band_range.begin = std::max(band_range.begin, 0.F);
+            band_range.end   = nearest_hit ? std::min(band_range.end, nearest_hit->distance) : band_range.end;
+            if (band_range.begin > band_range.end)
+                continue;
+
+            const float begin_height = GetRayHeight(origin_y, direction_y, band_range.begin);
+            const float end_height   = GetRayHeight(origin_y, direction_y, band_range.end);
+            height_min = std::min({ height_min, begin_height, end_height });
+            height_max = std::max({ height_max, begin_height, end_height });
+        }
+        if (height_min > height_max)
+            continue;
+
+        ForEachBandEntryInHeightRange(band, height_min - band_margin, height_max + band_margin,
+            [&ray, &direction, &nearest_hit, elapsed_radians, perturbation_ptr](const Entry& entry)
+            {
+                const hlslpp::float3 center           = GetEntryPosition(entry, elapsed_radians, perturbation_ptr);
+                const hlslpp::float3 center_to_origin = ray.origin - center;
+                const auto           half_b           = static_cast<float>(hlslpp::dot(center_to_origin, direction));
+                const float          c                = static_cast<float>(hlslpp::dot(center_to_origin, center_to_origin)) - entry.bounding_radius * entry.bounding_radius;
+                const float          discriminant     = half_b * half_b - c;
+                if ((c > 0.F && half_b > 0.F) || discriminant < 0.F)
+                    return;
+
+                const float distance = std::max(0.F, -half_b - std::sqrt(discriminant));
+                if (!nearest_hit || distance < nearest_hit->distance)
+                    nearest_hit = Hit{ entry.asteroid_index, distance };
+            }
+        );
+    }
+    return nearest_hit;
+}
+
+AsteroidsOrbitalIndex::Indices AsteroidsOrbitalIndex::QueryNear(const hlslpp::float3& point, float radius, double elapsed_seconds,
+                                                                 const Perturbation* perturbation_ptr) const
+{
+    META_FUNCTION_TASK();
+    const auto  point_x            = static_cast<float>(point.x);
+    const auto  point_y            = static_cast<float>(point.y);
+    const auto  point_z            = static_cast<float>(point.z);
+    const float point_orbit_radius = std::sqrt(point_x * point_x + point_z * point_z);
+    const auto  elapsed_radians    = static_cast<float>(std::numbers::pi * elapsed_seconds);
+
+    Indices asteroid_indices;
+    for (uint32_t band_index = 0U; band_index < GetBandsCount(); ++band_index)
+    {
+        const Band& band          = m_bands[band_index];
+        const float search_radius = radius + band.bounding_radius_max
+                                  + (perturbation_ptr ? perturbation_ptr->GetBandMargin(band_index, elapsed_seconds) : 0.F);
+        if (point_orbit_radius + search_radius < band.orbit_radius_min ||
+            point_orbit_radius - search_radius > band.orbit_radius_max)
+            continue;
+
+        ForEachBandEntryInHeightRange(band, point_y - search_radius, point_y + search_radius,
+            [&point, &asteroid_indices, radius, elapsed_radians, perturbation_ptr](const Entry& entry)
+            {
+                const hlslpp::float3 center          = GetEntryPosition(entry, elapsed_radians, perturbation_ptr);
+                const hlslpp::float3 center_to_point = point - center;
+                const float          max_distance    = radius + entry.bounding_radius;
+                if (static_cast<float>(hlslpp::dot(center_to_point, center_to_point)) <= max_distance * max_distance)
+                    asteroid_indices.push_back(entry.asteroid_index);
+            }
+        );
+    }
+
+    std::sort(asteroid_indices.begin(), asteroid_indices.end());
+    return asteroid_indices;
+}
+
+} // namespace Methane::Samples
@@ -0,0 +1,130 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsOrbitalIndex.h
+Time-invariant index of asteroid orbits for ray picking and proximity queries
+at arbitrary time without rebuilding as asteroids move.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Asteroid.h"
+
+#include <vector>
+#include <optional>
+#include <functional>
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+class AsteroidsOrbitalIndex
+{
+public:
+    struct Ray
+    {
+        hlslpp::float3 origin;
+        hlslpp::float3 direction; // normalized by queries
+    };
+
+    struct Hit
+    {
+        uint32_t asteroid_index;
+        float    distance;       // distance from ray origin to the bounding sphere of asteroid
+    };
+
+    // Perturbed asteroid is not farther than distance from its unperturbed orbit circle during the time window,
+    // and it is farther by no more than speed multiplied by time passed outside of the window
+    struct PerturbationBound
+    {
+        float distance = 0.F;
+        float speed    = 0.F;
+    };
+
+    using PerturbationBounds = std::vector<PerturbationBound>;
+
+    // Asteroids perturbed from their orbits (by gravity) are searched by orbit bands extended with the bound of asteroids
+    // in every band, so the index finds candidates with band-local margins and tests them at positions returned by the function
+    struct Perturbation
+    {
+        const PerturbationBounds*                               band_bounds_ptr;
+        double                                                  window_begin_seconds;
+        double                                                  window_end_seconds;
+        std::function<hlslpp::float3(uint32_t asteroid_index)> get_position;
+
+        [[nodiscard]] float GetBandMargin(uint32_t band_index, double elapsed_seconds) const;
+    };
+
+    using Parameters      = std::vector<Asteroid::Parameters>;
+    using MeshDepthMaxima = std::vector<float>; // maximum vertex depth of all LODs of every unique mesh instance
+    using Indices         = std::vector<uint32_t>;
+
+    // Asteroid orbits around Y axis, so its position is the orbit rotation of translation from scale-translate matrix
+    [[nodiscard]] static hlslpp::float3 GetOrbitPosition(const hlslpp::float3& translation, float orbit_angle_rad);
+
+    AsteroidsOrbitalIndex() = default;
+    AsteroidsOrbitalIndex(const Parameters& parameters, const MeshDepthMaxima& mesh_depth_maxima);
+
+    // Orbit radius and height of asteroids never change, so the ray or sphere is intersected with orbit radius bands
+    // and height ranges inside each band first, and orbit angles at the given time are computed only for candidate asteroids
+    [[nodiscard]] std::optional<Hit> Pick(const Ray& ray, double elapsed_seconds, const Perturbation* perturbation_ptr = nullptr) const;
+    [[nodiscard]] Indices QueryNear(const hlslpp::float3& point, float radius, double elapsed_seconds, const Perturbation* perturbation_ptr = nullptr) const;
+
+    // Bounds of asteroids are reduced to the maximum bounds of every band, which are cached by the caller between perturbation updates
+    [[nodiscard]] PerturbationBounds GetBandPerturbationBounds(const PerturbationBounds& asteroid_bounds) const;
+
+    [[nodiscard]] uint32_t GetAsteroidsCount() const noexcept { return static_cast<uint32_t>(m_entries.size()); }
+    [[nodiscard]] uint32_t GetBandsCount() const noexcept     { return static_cast<uint32_t>(m_bands.size()); }
+
+private:
+    // Asteroid entry with parameters required to compute its position, entries of every band are sorted by orbit height
+    struct Entry
+    {
+        float    orbit_height;
+        float    translation_x;
+        float    translation_z;
+        float    orbit_angle_rad;
+        float    orbit_speed;
+        float    bounding_radius;
+        uint32_t asteroid_index;
+    };
+
+    // Band of asteroids with close orbit radiuses
+    struct Band
+    {
+        float    orbit_radius_min;
+        float    orbit_radius_max;
+        float    bounding_radius_max;
+        uint32_t entries_begin;
+        uint32_t entries_end;
+    };
+
+    using Entries = std::vector<Entry>;
+    using Bands   = std::vector<Band>;
+
+    [[nodiscard]] static hlslpp::float3 GetEntryPosition(const Entry& entry, float elapsed_radians, const Perturbation* perturbation_ptr);
+
+    template<typename EntryFuncType>
+    void ForEachBandEntryInHeightRange(const Band& band, float height_min, float height_max, const EntryFuncType& entry_func) const;
+
+    Entries m_entries;
+    Bands   m_bands;
+};
+
+} // namespace Methane::Samples
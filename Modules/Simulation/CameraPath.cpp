@@ -0,0 +1,143 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: CameraPath.cpp
+Keyframed path of view and light cameras for deterministic benchmark replay
+
+******************************************************************************/
+
+#include "CameraPath.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <fstream>
+#include <array>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Methane::Samples
+{
+
+static const hlslpp::float3 g_camera_up_direction(0.F, 1.F, 0.F);
+static constexpr uint32_t   g_orbit_keyframes_count = 64U;
+
+[[nodiscard]]
+static gfx::Camera::Orientation InterpolateOrientation(const gfx::Camera::Orientation& from, const gfx::Camera::Orientation& to, float ratio)
+{
+    return gfx::Camera::Orientation{
+        hlslpp::lerp(from.eye, to.eye, ratio),
+        hlslpp::lerp(from.aim, to.aim, ratio),
+        hlslpp::normalize(hlslpp::lerp(from.up, to.up, ratio))
+    };
+}
+
+CameraPath CameraPath::LoadFromFile(const std::string& file_path)
+{
+    META_FUNCTION_TASK();
+    std::ifstream path_file(file_path);
+    META_CHECK_TRUE_DESCR(path_file.is_open(), "failed to open camera path file '{}'", file_path);
+
+    Keyframes   keyframes;
+    std::string line;
+    uint32_t    line_number = 0U;
+    while (std::getline(path_file, line))
+    {
+        ++line_number;
+        const size_t first_char_pos = line.find_first_not_of(" \t\r");
+        if (first_char_pos == std::string::npos || line[first_char_pos] == '#')
+            continue;
+
+        std::istringstream line_stream(line);
+        double time_sec = 0.0;
+        std::array<float, 12> values{};
+        line_stream >> time_sec;
+        for (float& value : values)
+        {
+            line_stream >> value;
+        }
+        META_CHECK_TRUE_DESCR(!line_stream.fail(), "invalid camera path keyframe at line {} of file '{}'", line_number, file_path);
+        META_CHECK_TRUE_DESCR(keyframes.empty() || time_sec > keyframes.back().time_sec,
+                              "camera path keyframe time is not increasing at line {} of file '{}'", line_number, file_path);
+
+        keyframes.push_back(Keyframe{
+            time_sec,
+            { hlslpp::float3(values[0], values[1], values[2]), hlslpp::float3(values[3], values[4],  values[5]),  g_camera_up_direction },
+            { hlslpp::float3(values[6], values[7], values[8]), hlslpp::float3(values[9], values[10], values[11]), g_camera_up_direction }
+        });
+    }
+    return CameraPath(std::move(keyframes));
+}
+
+CameraPath CameraPath::CreateOrbit(const gfx::Camera::Orientation& view_orientation,
+                                   const gfx::Camera::Orientation& light_orientation,
+                                   double duration_sec)
+{
+    META_FUNCTION_TASK();
+    const hlslpp::float3 aim_to_eye = view_orientation.eye - view_orientation.aim;
+
+    Keyframes keyframes;
+    keyframes.reserve(g_orbit_keyframes_count + 1U);
+    for (uint32_t keyframe_index = 0U; keyframe_index <= g_orbit_keyframes_count; ++keyframe_index)
+    {
+        const float ratio     = static_cast<float>(keyframe_index) / static_cast<float>(g_orbit_keyframes_count);
+        const float angle_rad = 2.F * std::numbers::pi_v<float> * ratio;
+        const float cos_angle = std::cos(angle_rad);
+        const float sin_angle = std::sin(angle_rad);
+        const hlslpp::float3 rotated_aim_to_eye(aim_to_eye.x * cos_angle - aim_to_eye.z * sin_angle,
+                                                aim_to_eye.y,
+                                                aim_to_eye.x * sin_angle + aim_to_eye.z * cos_angle);
+        keyframes.push_back(Keyframe{
+            duration_sec * static_cast<double>(ratio),
+            { view_orientation.aim + rotated_aim_to_eye, view_orientation.aim, view_orientation.up },
+            light_orientation
+        });
+    }
+    return CameraPath(std::move(keyframes));
+}
+
+CameraPath::CameraPath(Keyframes keyframes)
+    : m_keyframes(std::move(keyframes))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_EMPTY_DESCR(m_keyframes, "camera path must have at least one keyframe");
+}
+
+void CameraPath::Apply(double time_sec, gfx::Camera& view_camera, gfx::Camera& light_camera) const
+{
+    META_FUNCTION_TASK();
+    const auto next_keyframe_it = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), time_sec,
+                                                   [](double time, const Keyframe& keyframe) { return time < keyframe.time_sec; });
+    if (next_keyframe_it == m_keyframes.begin() || next_keyframe_it == m_keyframes.end())
+    {
+        const Keyframe& keyframe = next_keyframe_it == m_keyframes.begin() ? m_keyframes.front() : m_keyframes.back();
+        view_camera.SetOrientation(keyframe.view_orientation);
+        light_camera.SetOrientation(keyframe.light_orientation);
+        return;
+    }
+
+    const Keyframe& prev_keyframe = *std::prev(next_keyframe_it);
+    const Keyframe& next_keyframe = *next_keyframe_it;
+    const auto      ratio         = static_cast<float>((time_sec - prev_keyframe.time_sec) / (next_keyframe.time_sec - prev_keyframe.time_sec));
+    view_camera.SetOrientation(InterpolateOrientation(prev_keyframe.view_orientation, next_keyframe.view_orientation, ratio));
+    light_camera.SetOrientation(InterpolateOrientation(prev_keyframe.light_orientation, next_keyframe.light_orientation, ratio));
+}
+
+} // namespace Methane::Samples
@@ -0,0 +1,70 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: CameraPath.h
+Keyframed path of view and light cameras for deterministic benchmark replay
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Camera.h>
+
+#include <vector>
+#include <string>
+
+namespace Methane::Samples
+{
+
+namespace gfx = Graphics;
+
+class CameraPath
+{
+public:
+    struct Keyframe
+    {
+        double                   time_sec;
+        gfx::Camera::Orientation view_orientation;
+        gfx::Camera::Orientation light_orientation;
+    };
+
+    using Keyframes = std::vector<Keyframe>;
+
+    // Text file with one keyframe per line, lines starting with '#' are comments:
+    // time_sec  view_eye.xyz  view_aim.xyz  light_eye.xyz  light_aim.xyz
+    // Up direction of both cameras is the Y axis
+    [[nodiscard]] static CameraPath LoadFromFile(const std::string& file_path);
+
+    // Orbit of view camera around its aim point with a fixed light camera, used when no path file is given
+    [[nodiscard]] static CameraPath CreateOrbit(const gfx::Camera::Orientation& view_orientation,
+                                                const gfx::Camera::Orientation& light_orientation,
+                                                double duration_sec);
+
+    explicit CameraPath(Keyframes keyframes);
+
+    [[nodiscard]] const Keyframes& GetKeyframes() const noexcept { return m_keyframes; }
+    [[nodiscard]] double           GetDuration() const noexcept  { return m_keyframes.back().time_sec; }
+
+    // Orientations are linearly interpolated between keyframes and clamped to the first and last keyframes
+    void Apply(double time_sec, gfx::Camera& view_camera, gfx::Camera& light_camera) const;
+
+private:
+    Keyframes m_keyframes;
+};
+
+} // namespace Methane::Samples
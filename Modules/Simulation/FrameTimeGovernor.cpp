@@ -0,0 +1,126 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: FrameTimeGovernor.cpp
+Governor of asteroids rendering quality, which holds frame time at the target
+by changing drawn fraction of asteroids and mesh LOD bias with hysteresis.
+
+******************************************************************************/
+
+#include "FrameTimeGovernor.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+
+namespace Methane::Samples
+{
+
+FrameTimeGovernor::FrameTimeGovernor(const Settings& settings)
+    : m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER(m_settings.target_frame_seconds, 0.0);
+    META_CHECK_GREATER(m_settings.lod_bias_step, 1.F);
+    META_CHECK_LESS_OR_EQUAL(m_settings.min_drawn_fraction, 1.F);
+}
+
+bool FrameTimeGovernor::AddFrameTimes(double frame_seconds, double cpu_seconds)
+{
+    META_FUNCTION_TASK();
+    if (frame_seconds <= 0.0)
+        return false;
+
+    if (m_frame_seconds > 0.0)
+    {
+        m_frame_seconds += (frame_seconds - m_frame_seconds) * m_settings.smoothing_factor;
+        m_cpu_seconds   += (cpu_seconds - m_cpu_seconds) * m_settings.smoothing_factor;
+    }
+    else
+    {
+        m_frame_seconds = frame_seconds;
+        m_cpu_seconds   = cpu_seconds;
+    }
+
+    if (m_settle_frames_count)
+    {
+        --m_settle_frames_count;
+        return false;
+    }
+
+    // Quality is not changed while frame time is within the tolerance band around the target,
+    // which is wider below the target, so that raised quality does not immediately exceed the target again
+    bool is_quality_changed = false;
+    if (m_frame_seconds > m_settings.target_frame_seconds * (1.0 + m_settings.upper_tolerance))
+        is_quality_changed = LowerQuality();
+    else if (m_frame_seconds < m_settings.target_frame_seconds * (1.0 - m_settings.lower_tolerance))
+        is_quality_changed = RaiseQuality();
+
+    if (is_quality_changed)
+    {
+        m_settle_frames_count = m_settings.settle_frames_count;
+    }
+    return is_quality_changed;
+}
+
+bool FrameTimeGovernor::IsCpuBound() const noexcept
+{
+    return m_cpu_seconds >= m_frame_seconds * m_settings.cpu_bound_ratio;
+}
+
+bool FrameTimeGovernor::LowerQuality()
+{
+    META_FUNCTION_TASK();
+
+    // Dropped asteroids reduce both update and draw costs, so they are dropped first in CPU bound frames,
+    // while coarser mesh LODs reduce GPU cost only with less visible changes, so they are used first in frames which are not CPU bound
+    const bool can_drop_asteroids = m_quality.drawn_fraction > m_settings.min_drawn_fraction;
+    const bool can_raise_lod_bias = m_quality.lod_bias < m_settings.max_lod_bias;
+    if (can_raise_lod_bias && (!can_drop_asteroids || !IsCpuBound()))
+    {
+        m_quality.lod_bias = std::min(m_settings.max_lod_bias, m_quality.lod_bias * m_settings.lod_bias_step);
+        return true;
+    }
+    if (can_drop_asteroids)
+    {
+        m_quality.drawn_fraction = std::max(m_settings.min_drawn_fraction, m_quality.drawn_fraction - m_settings.drawn_fraction_step);
+        return true;
+    }
+    return false;
+}
+
+bool FrameTimeGovernor::RaiseQuality()
+{
+    META_FUNCTION_TASK();
+
+    // Dropped asteroids are the most visible quality loss, so they are returned before mesh LODs are refined
+    if (m_quality.drawn_fraction < 1.F)
+    {
+        m_quality.drawn_fraction = std::min(1.F, m_quality.drawn_fraction + m_settings.drawn_fraction_step);
+        return true;
+    }
+    if (m_quality.lod_bias > 1.F)
+    {
+        m_quality.lod_bias = std::max(1.F, m_quality.lod_bias / m_settings.lod_bias_step);
+        return true;
+    }
+    return false;
+}
+
+} // namespace Methane::Samples
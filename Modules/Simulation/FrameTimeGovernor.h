@@ -0,0 +1,79 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: FrameTimeGovernor.h
+Governor of asteroids rendering quality, which holds frame time at the target
+by changing drawn fraction of asteroids and mesh LOD bias with hysteresis.
+
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+class FrameTimeGovernor
+{
+public:
+    struct Settings
+    {
+        double   target_frame_seconds = 1.0 / 60.0;
+        double   upper_tolerance      = 0.05;  // quality is lowered when smoothed frame time exceeds the target by this ratio
+        double   lower_tolerance      = 0.15;  // quality is raised when smoothed frame time is below the target by this ratio
+        double   smoothing_factor     = 0.1;   // exponential moving average factor of measured frame times
+        double   cpu_bound_ratio      = 0.8;   // frame is CPU bound when CPU stages take this part of the frame interval
+        uint32_t settle_frames_count  = 30U;   // frames skipped after quality change, while frame time settles
+        float    min_drawn_fraction   = 0.1F;
+        float    drawn_fraction_step  = 0.05F;
+        float    max_lod_bias         = 8.F;
+        float    lod_bias_step        = 1.25F; // LOD bias is multiplied or divided by this step
+    };
+
+    struct Quality
+    {
+        float drawn_fraction = 1.F; // fraction of asteroids drawn, the smallest and farthest are dropped first
+        float lod_bias       = 1.F; // multiplier of mesh LOD screen error
+    };
+
+    explicit FrameTimeGovernor(const Settings& settings);
+
+    // Only CPU stages are measured, so frame is known to be CPU bound when they take most of the frame interval;
+    // otherwise the rest of the interval is spent waiting for GPU or presentation, which are not distinguished without GPU timestamps.
+    // Returns true when quality was changed
+    bool AddFrameTimes(double frame_seconds, double cpu_seconds);
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept     { return m_settings; }
+    [[nodiscard]] const Quality&  GetQuality() const noexcept      { return m_quality; }
+    [[nodiscard]] double          GetFrameSeconds() const noexcept { return m_frame_seconds; }
+    [[nodiscard]] double          GetCpuSeconds() const noexcept   { return m_cpu_seconds; }
+    [[nodiscard]] bool            IsCpuBound() const noexcept;
+
+private:
+    bool LowerQuality();
+    bool RaiseQuality();
+
+    Settings m_settings;
+    Quality  m_quality;
+    double   m_frame_seconds = 0.0; // smoothed frame interval
+    double   m_cpu_seconds   = 0.0; // smoothed duration of CPU stages
+    uint32_t m_settle_frames_count = 0U;
+};
+
+} // namespace Methane::Samples
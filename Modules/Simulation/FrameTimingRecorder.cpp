@@ -0,0 +1,317 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: FrameTimingRecorder.cpp
+Recorder of per-frame stage durations in fixed-size lock-free ring buffer
+with CSV/JSON export and percentile statistics.
+
+******************************************************************************/
+
+#include "FrameTimingRecorder.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <fmt/format.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Samples
+{
+
+static constexpr double g_milliseconds_per_second = 1000.0;
+
+[[nodiscard]]
+static double GetPercentile(const std::vector<double>& sorted_values, double percentile)
+{
+    if (sorted_values.empty())
+        return 0.0;
+
+    // Nearest-rank method
+    const auto rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted_values.size())));
+    return sorted_values[std::clamp<size_t>(rank, 1U, sorted_values.size()) - 1U];
+}
+
+FrameTimingRecorder::StageTimer::StageTimer(FrameTimingRecorder* recorder_ptr, Stage stage) noexcept
+    : m_recorder_ptr(recorder_ptr)
+    , m_stage(stage)
+    , m_begin_time(recorder_ptr ? Clock::now() : Clock::time_point())
+{ }
+
+FrameTimingRecorder::StageTimer::~StageTimer()
+{
+    if (m_recorder_ptr)
+    {
+        m_recorder_ptr->AddStageSeconds(m_stage, std::chrono::duration<double>(Clock::now() - m_begin_time).count());
+    }
+}
+
+FrameTimingRecorder::ThreadEncodingTimer::ThreadEncodingTimer(FrameTimingRecorder* recorder_ptr, uint32_t thread_index) noexcept
+    : m_recorder_ptr(recorder_ptr)
+    , m_thread_index(thread_index)
+    , m_begin_time(recorder_ptr ? Clock::now() : Clock::time_point())
+{ }
+
+FrameTimingRecorder::ThreadEncodingTimer::~ThreadEncodingTimer()
+{
+    if (m_recorder_ptr)
+    {
+        m_recorder_ptr->AddThreadEncodingSeconds(m_thread_index, std::chrono::duration<double>(Clock::now() - m_begin_time).count());
+    }
+}
+
+FrameTimingRecorder::FrameTimingRecorder(uint32_t frames_capacity)
+    : m_frames(std::max(frames_capacity, 2U))
+{
+    META_FUNCTION_TASK();
+}
+
+std::string_view FrameTimingRecorder::GetStageName(Stage stage)
+{
+    META_FUNCTION_TASK();
+    switch(stage)
+    {
+    using enum Stage;
+    case AsteroidsUpdate: return "asteroids_update";
+    case UniformsUpload:  return "uniforms_upload";
+    case DrawEncoding:    return "draw_encoding";
+    case FinalEncoding:   return "final_encoding";
+    case Execute:         return "execute";
+    case Present:         return "present";
+    case Frame:           return "frame";
+    default:              META_UNEXPECTED_RETURN(stage, "");
+    }
+}
+
+uint64_t FrameTimingRecorder::GetRecordedFramesCount() const noexcept
+{
+    // Current frame is still being recorded, so it is not counted
+    const uint64_t frame_index = m_frame_index.load(std::memory_order_acquire);
+    return frame_index > 0U ? std::min<uint64_t>(frame_index - 1U, m_frames.size() - 1U) : 0U;
+}
+
+void FrameTimingRecorder::BeginFrame()
+{
+    META_FUNCTION_TASK();
+    const Clock::time_point frame_begin_time = Clock::now();
+    const uint64_t          prev_frame_index = m_frame_index.load(std::memory_order_relaxed);
+    if (prev_frame_index > 0U)
+    {
+        AddStageSeconds(Stage::Frame, std::chrono::duration<double>(frame_begin_time - m_frame_begin_time).count());
+    }
+    m_frame_begin_time = frame_begin_time;
+
+    // The oldest frame record is overwritten by the new frame
+    const uint64_t frame_index  = prev_frame_index + 1U;
+    FrameRecord&   frame_record = m_frames[(frame_index - 1U) % m_frames.size()];
+    frame_record.frame_index.store(frame_index, std::memory_order_relaxed);
+    for (std::atomic<float>& stage_seconds : frame_record.stage_seconds)
+    {
+        stage_seconds.store(0.F, std::memory_order_relaxed);
+    }
+    for (std::atomic<float>& thread_seconds : frame_record.thread_encoding_seconds)
+    {
+        thread_seconds.store(0.F, std::memory_order_relaxed);
+    }
+    m_frame_index.store(frame_index, std::memory_order_release);
+}
+
+void FrameTimingRecorder::AddStageSeconds(Stage stage, double seconds) noexcept
+{
+    if (!m_frame_index.load(std::memory_order_acquire))
+        return;
+
+    GetCurrentFrameRecord().stage_seconds[static_cast<size_t>(stage)].fetch_add(static_cast<float>(seconds), std::memory_order_relaxed);
+}
+
+void FrameTimingRecorder::AddThreadEncodingSeconds(uint32_t thread_index, double seconds) noexcept
+{
+    if (!m_frame_index.load(std::memory_order_acquire) || thread_index >= max_threads_count)
+        return;
+
+    GetCurrentFrameRecord().thread_encoding_seconds[thread_index].fetch_add(static_cast<float>(seconds), std::memory_order_relaxed);
+
+    uint32_t threads_count = m_threads_count.load(std::memory_order_relaxed);
+    while (threads_count <= thread_index &&
+           !m_threads_count.compare_exchange_weak(threads_count, thread_index + 1U, std::memory_order_relaxed));
+}
+
+FrameTimingRecorder::StagePercentiles FrameTimingRecorder::GetStagePercentiles() const
+{
+    META_FUNCTION_TASK();
+    const std::vector<const FrameRecord*> frame_records = GetCompletedFrames();
+
+    StagePercentiles stage_percentiles{};
+    std::vector<double> stage_values;
+    stage_values.reserve(frame_records.size());
+    for (size_t stage_index = 0U; stage_index < stages_count; ++stage_index)
+    {
+        stage_values.clear();
+        for (const FrameRecord* frame_record_ptr : frame_records)
+        {
+            stage_values.push_back(static_cast<double>(frame_record_ptr->stage_seconds[stage_index].load(std::memory_order_relaxed)));
+        }
+        std::sort(stage_values.begin(), stage_values.end());
+        stage_percentiles[stage_index] = Percentiles{
+            .p50 = GetPercentile(stage_values, 0.50),
+            .p95 = GetPercentile(stage_values, 0.95),
+            .p99 = GetPercentile(stage_values, 0.99)
+        };
+    }
+    return stage_percentiles;
+}
+
+FrameTimingRecorder::StageSeconds FrameTimingRecorder::GetLastFrameStageSeconds() const
+{
+    META_FUNCTION_TASK();
+    StageSeconds stage_seconds{};
+    const uint64_t current_frame_index = m_frame_index.load(std::memory_order_acquire);
+    if (current_frame_index < 2U)
+        return stage_seconds;
+
+    const FrameRecord& frame_record = m_frames[(current_frame_index - 2U) % m_frames.size()];
+    for (size_t stage_index = 0U; stage_index < stages_count; ++stage_index)
+    {
+        stage_seconds[stage_index] = static_cast<double>(frame_record.stage_seconds[stage_index].load(std::memory_order_relaxed));
+    }
+    return stage_seconds;
+}
+
+std::string FrameTimingRecorder::GetSummary() const
+{
+    META_FUNCTION_TASK();
+    const StagePercentiles stage_percentiles = GetStagePercentiles();
+
+    std::stringstream ss;
+    ss << "Frame timings of " << GetRecordedFramesCount() << " last frames (p50 / p95 / p99):";
+    for (size_t stage_index = 0U; stage_index < stages_count; ++stage_index)
+    {
+        const Percentiles& percentiles = stage_percentiles[stage_index];
+        ss << std::endl << fmt::format("  - {:<18} {:>8.3f} / {:>8.3f} / {:>8.3f} ms",
+                                       GetStageName(static_cast<Stage>(stage_index)),
+                                       percentiles.p50 * g_milliseconds_per_second,
+                                       percentiles.p95 * g_milliseconds_per_second,
+                                       percentiles.p99 * g_milliseconds_per_second);
+    }
+    return ss.str();
+}
+
+void FrameTimingRecorder::ExportCsv(const std::string& file_path) const
+{
+    META_FUNCTION_TASK();
+    std::ofstream csv_file(file_path, std::ios::out | std::ios::trunc);
+    META_CHECK_TRUE_DESCR(csv_file.is_open(), "failed to open frame timings CSV file '{}'", file_path);
+
+    const uint32_t threads_count = m_threads_count.load(std::memory_order_relaxed);
+    csv_file << "frame";
+    for (size_t stage_index = 0U; stage_index < stages_count; ++stage_index)
+    {
+        csv_file << "," << GetStageName(static_cast<Stage>(stage_index)) << "_ms";
+    }
+    for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        csv_file << ",draw_encoding_thread_" << thread_index << "_ms";
+    }
+    csv_file << "\n";
+
+    for (const FrameRecord* frame_record_ptr : GetCompletedFrames())
+    {
+        csv_file << frame_record_ptr->frame_index.load(std::memory_order_relaxed);
+        for (const std::atomic<float>& stage_seconds : frame_record_ptr->stage_seconds)
+        {
+            csv_file << fmt::format(",{:.4f}", stage_seconds.load(std::memory_order_relaxed) * g_milliseconds_per_second);
+        }
+        for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            csv_file << fmt::format(",{:.4f}", frame_record_ptr->thread_encoding_seconds[thread_index].load(std::memory_order_relaxed) * g_milliseconds_per_second);
+        }
+        csv_file << "\n";
+    }
+}
+
+void FrameTimingRecorder::ExportJson(const std::string& file_path) const
+{
+    META_FUNCTION_TASK();
+    std::ofstream json_file(file_path, std::ios::out | std::ios::trunc);
+    META_CHECK_TRUE_DESCR(json_file.is_open(), "failed to open frame timings JSON file '{}'", file_path);
+
+    const uint32_t                        threads_count     = m_threads_count.load(std::memory_order_relaxed);
+    const std::vector<const FrameRecord*> frame_records     = GetCompletedFrames();
+    const StagePercentiles                stage_percentiles = GetStagePercentiles();
+
+    json_file << "{\n  \"frames_count\": " << frame_records.size() << ",\n  \"percentiles_ms\": {";
+    for (size_t stage_index = 0U; stage_index < stages_count; ++stage_index)
+    {
+        const Percentiles& percentiles = stage_percentiles[stage_index];
+        json_file << (stage_index ? "," : "")
+                  << fmt::format("\n    \"{}\": {{ \"p50\": {:.4f}, \"p95\": {:.4f}, \"p99\": {:.4f} }}",
+                                 GetStageName(static_cast<Stage>(stage_index)),
+                                 percentiles.p50 * g_milliseconds_per_second,
+                                 percentiles.p95 * g_milliseconds_per_second,
+                                 percentiles.p99 * g_milliseconds_per_second);
+    }
+    json_file << "\n  },\n  \"frames\": [";
+
+    for (size_t record_index = 0U; record_index < frame_records.size(); ++record_index)
+    {
+        const FrameRecord& frame_record = *frame_records[record_index];
+        json_file << (record_index ? "," : "") << "\n    { \"frame\": " << frame_record.frame_index.load(std::memory_order_relaxed);
+        for (size_t stage_index = 0U; stage_index < stages_count; ++stage_index)
+        {
+            json_file << fmt::format(", \"{}_ms\": {:.4f}", GetStageName(static_cast<Stage>(stage_index)),
+                                     frame_record.stage_seconds[stage_index].load(std::memory_order_relaxed) * g_milliseconds_per_second);
+        }
+        json_file << ", \"draw_encoding_threads_ms\": [";
+        for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            json_file << (thread_index ? ", " : "")
+                      << fmt::format("{:.4f}", frame_record.thread_encoding_seconds[thread_index].load(std::memory_order_relaxed) * g_milliseconds_per_second);
+        }
+        json_file << "] }";
+    }
+    json_file << "\n  ]\n}\n";
+}
+
+std::vector<const FrameTimingRecorder::FrameRecord*> FrameTimingRecorder::GetCompletedFrames() const
+{
+    META_FUNCTION_TASK();
+    const uint64_t current_frame_index = m_frame_index.load(std::memory_order_acquire);
+    const uint64_t frames_count        = current_frame_index > 0U ? std::min<uint64_t>(current_frame_index - 1U, m_frames.size() - 1U) : 0U;
+
+    // Records are validated with their frame index to skip ones overwritten while reading
+    std::vector<const FrameRecord*> frame_records;
+    frame_records.reserve(frames_count);
+    for (uint64_t frame_index = current_frame_index - frames_count; frame_index < current_frame_index; ++frame_index)
+    {
+        const FrameRecord& frame_record = m_frames[(frame_index - 1U) % m_frames.size()];
+        if (frame_record.frame_index.load(std::memory_order_relaxed) == frame_index)
+        {
+            frame_records.push_back(&frame_record);
+        }
+    }
+    return frame_records;
+}
+
+FrameTimingRecorder::FrameRecord& FrameTimingRecorder::GetCurrentFrameRecord() noexcept
+{
+    return m_frames[(m_frame_index.load(std::memory_order_relaxed) - 1U) % m_frames.size()];
+}
+
+} // namespace Methane::Samples
@@ -0,0 +1,138 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: FrameTimingRecorder.h
+Recorder of per-frame stage durations in fixed-size lock-free ring buffer
+with CSV/JSON export and percentile statistics.
+
+******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+class FrameTimingRecorder
+{
+public:
+    enum class Stage : uint32_t
+    {
+        AsteroidsUpdate = 0U, // AsteroidsArray::Update of instance uniforms and mesh LODs
+        UniformsUpload,       // Upload of asteroid uniforms to GPU, running asynchronously with draw encoding
+        DrawEncoding,         // Encoding of asteroids draw commands, including wait for uniforms upload completion
+        FinalEncoding,        // Encoding of planet, sky-box and overlay draw commands in final command list
+        Execute,              // Execution of frame command lists on render command queue
+        Present,              // Presentation of frame to screen
+        Frame,                // Interval between beginnings of consecutive frames
+
+        Count
+    };
+
+    static constexpr size_t   stages_count      = static_cast<size_t>(Stage::Count);
+    static constexpr uint32_t max_threads_count = 64U;
+
+    struct Percentiles
+    {
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+    };
+
+    using StagePercentiles = std::array<Percentiles, stages_count>;
+    using StageSeconds     = std::array<double, stages_count>;
+
+    // Measures duration of the stage in scope and adds it to the current frame record
+    class StageTimer
+    {
+    public:
+        StageTimer(FrameTimingRecorder* recorder_ptr, Stage stage) noexcept;
+        ~StageTimer();
+
+        StageTimer(const StageTimer&) = delete;
+        StageTimer& operator=(const StageTimer&) = delete;
+
+    private:
+        FrameTimingRecorder*                           m_recorder_ptr;
+        Stage                                          m_stage;
+        std::chrono::high_resolution_clock::time_point m_begin_time;
+    };
+
+    // Measures duration of draw commands encoding by the thread of parallel command list in scope
+    class ThreadEncodingTimer
+    {
+    public:
+        ThreadEncodingTimer(FrameTimingRecorder* recorder_ptr, uint32_t thread_index) noexcept;
+        ~ThreadEncodingTimer();
+
+        ThreadEncodingTimer(const ThreadEncodingTimer&) = delete;
+        ThreadEncodingTimer& operator=(const ThreadEncodingTimer&) = delete;
+
+    private:
+        FrameTimingRecorder*                           m_recorder_ptr;
+        uint32_t                                       m_thread_index;
+        std::chrono::high_resolution_clock::time_point m_begin_time;
+    };
+
+    explicit FrameTimingRecorder(uint32_t frames_capacity);
+
+    [[nodiscard]] static std::string_view GetStageName(Stage stage);
+
+    [[nodiscard]] uint32_t GetFramesCapacity() const noexcept { return static_cast<uint32_t>(m_frames.size()); }
+    [[nodiscard]] uint64_t GetRecordedFramesCount() const noexcept;
+
+    // Frame timings are written by the render thread and draw encoding threads of the current frame only,
+    // while completed frames can be read concurrently for export without locking
+    void BeginFrame();
+    void AddStageSeconds(Stage stage, double seconds) noexcept;
+    void AddThreadEncodingSeconds(uint32_t thread_index, double seconds) noexcept;
+
+    [[nodiscard]] StagePercentiles GetStagePercentiles() const;
+    [[nodiscard]] StageSeconds     GetLastFrameStageSeconds() const; // zero durations until the first frame is completed
+    [[nodiscard]] std::string      GetSummary() const;
+
+    void ExportCsv(const std::string& file_path) const;
+    void ExportJson(const std::string& file_path) const;
+
+private:
+    struct FrameRecord
+    {
+        std::atomic<uint64_t>                             frame_index{ 0U };
+        std::array<std::atomic<float>, stages_count>      stage_seconds{ };
+        std::array<std::atomic<float>, max_threads_count> thread_encoding_seconds{ };
+    };
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    [[nodiscard]] std::vector<const FrameRecord*> GetCompletedFrames() const;
+    [[nodiscard]] FrameRecord& GetCurrentFrameRecord() noexcept;
+
+    std::vector<FrameRecord> m_frames;
+    std::atomic<uint64_t>    m_frame_index{ 0U };
+    std::atomic<uint32_t>    m_threads_count{ 0U };
+    Clock::time_point        m_frame_begin_time;
+};
+
+} // namespace Methane::Samples
@@ -43,4 +43,41 @@ struct META_UNIFORM_ALIGN AsteroidUniforms
     uint     texture_index;
 };
 
+// Compact per-instance uniforms packed in structured buffer for instanced batch rendering (64 bytes):
+// rows of transposed model matrix without constant last column, mesh depth range, colors palette indices and texture index
+struct AsteroidInstanceUniforms
+{
+    float4 model_matrix_x;
+    float4 model_matrix_y;
+    float4 model_matrix_z;
+    float  depth_min;
+    float  depth_max;
+    uint   color_indices;    // low 16 bits: deep color palette index, high 16 bits: shallow color palette index
+    uint   texture_index;
+};
+
+// Static motion parameters of asteroid uploaded once for model matrix evaluation in vertex shader (80 bytes):
+// rows of transposed model matrix at zero time, spin and orbit angular velocities, colors palette indices and texture index
+struct AsteroidMotionUniforms
+{
+    float4 model_matrix_x;
+    float4 model_matrix_y;
+    float4 model_matrix_z;
+    float4 angular_velocity; // xyz: spin axis scaled by spin speed, w: orbit speed around Y axis
+    uint   color_indices;    // low 16 bits: deep color palette index, high 16 bits: shallow color palette index
+    uint   texture_index;
+#ifndef __cplusplus
+    uint2  _;
+#endif
+};
+
+struct AsteroidBatchConstants
+{
+    uint  instance_offset;
+    uint  lod_color_indices; // GPU motion: colors palette indices of mesh subset LOD, all bits are set when asteroid colors are used
+    float depth_min;         // GPU motion: depth range of mesh subset
+    float depth_max;
+    float elapsed_radians;   // GPU motion: time of asteroids motion
+};
+
 #endif // ASTEROID_UNIFORMS_H
@@ -39,6 +39,13 @@ struct VSInput
     float3 normal            : NORMAL;
 };
 
+struct SharedVSInput
+{
+    float3 position          : POSITION;
+    float3 normal            : NORMAL;
+    uint   instance_index    : INSTANCE_INDEX;
+};
+
 struct PSInput
 {
     float4 position          : SV_POSITION;
@@ -49,11 +56,23 @@ struct PSInput
     float3 face_blend_weights: BLENDWEIGHT;
 };
 
+struct BatchPSInput
+{
+    PSInput          base;
+    nointerpolation uint texture_index : TEXINDEX;
+};
+
 ConstantBuffer<AsteroidUniforms> g_mesh_uniforms                 : register(b0, META_ARG_MUTABLE);
 ConstantBuffer<SceneUniforms>    g_scene_uniforms                : register(b1, META_ARG_FRAME_CONSTANT);
 ConstantBuffer<SceneConstants>   g_constants                     : register(b2, META_ARG_CONSTANT);
+ConstantBuffer<AsteroidBatchConstants>     g_batch_constants     : register(b3, META_ARG_MUTABLE);
+StructuredBuffer<AsteroidInstanceUniforms> g_instance_uniforms   : register(t0, META_ARG_FRAME_CONSTANT);
+StructuredBuffer<float4>                   g_colors_palette      : register(t1, META_ARG_CONSTANT);
+StructuredBuffer<AsteroidMotionUniforms>   g_motion_uniforms     : register(t2, META_ARG_CONSTANT);
+StructuredBuffer<uint>                     g_instance_indices    : register(t3, META_ARG_FRAME_CONSTANT);
 SamplerState                     g_texture_sampler               : register(s0, META_ARG_CONSTANT);
-Texture2DArray<float4>           g_face_textures[TEXTURES_COUNT] : register(t0,
+// Face textures array starts after structured buffers, so that its range never aliases their registers in any space
+Texture2DArray<float4>           g_face_textures[TEXTURES_COUNT] : register(t4,
 #if TEXTURES_COUNT > 1
     META_ARG_CONSTANT
 #else
@@ -61,20 +80,20 @@ Texture2DArray<float4>           g_face_textures[TEXTURES_COUNT] : register(t0,
 #endif
 );
 
-PSInput AsteroidVS(VSInput input)
+PSInput GetAsteroidVertex(VSInput input, float4x4 model_matrix, float3 deep_color, float3 shallow_color, float depth_min, float depth_max)
 {
     const float4 position = float4(input.position, 1.0F);
-    const float  depth    = linstep(g_mesh_uniforms.depth_min, g_mesh_uniforms.depth_max, length(input.position.xyz));
+    const float  depth    = linstep(depth_min, depth_max, length(input.position.xyz));
 
     PSInput output;
-    output.world_position    = mul(position, g_mesh_uniforms.model_matrix);
+    output.world_position    = mul(position, model_matrix);
     output.position          = mul(output.world_position, g_scene_uniforms.view_proj_matrix);
 
-    output.world_normal      = normalize(mul(float4(input.normal, 0.0), g_mesh_uniforms.model_matrix).xyz);
-    output.albedo            = lerp(g_mesh_uniforms.deep_color, g_mesh_uniforms.shallow_color, depth);
+    output.world_normal      = normalize(mul(float4(input.normal, 0.0), model_matrix).xyz);
+    output.albedo            = lerp(deep_color, shallow_color, depth);
 
     // Prepare coordinates and blending weights for tri-planar projection texturing
-    output.uvw               = input.position / g_mesh_uniforms.depth_max * 0.5F + 0.5F;
+    output.uvw               = input.position / depth_max * 0.5F + 0.5F;
     output.face_blend_weights = abs(normalize(input.position));
     output.face_blend_weights = saturate((output.face_blend_weights - 0.2F) * 7.0F);
     output.face_blend_weights /= (output.face_blend_weights.x + output.face_blend_weights.y + output.face_blend_weights.z).xxx;
@@ -82,7 +101,7 @@ PSInput AsteroidVS(VSInput input)
     return output;
 }
 
-float4 AsteroidPS(PSInput input) : SV_TARGET
+float4 GetAsteroidColor(PSInput input, uint tex_index)
 {
     const float3 fragment_to_light  = normalize(g_scene_uniforms.light_position - input.world_position.xyz);
     const float3 fragment_to_eye    = normalize(g_scene_uniforms.eye_position - input.world_position.xyz);
@@ -90,7 +109,6 @@ float4 AsteroidPS(PSInput input) : SV_TARGET
 
     // Tri-planar projection sampling
     float3 texel_rgb = 0.0;
-    const uint tex_index = g_mesh_uniforms.texture_index;
     texel_rgb += input.face_blend_weights.x * g_face_textures[tex_index].Sample(g_texture_sampler, float3(input.uvw.yz, 0)).xyz;
     texel_rgb += input.face_blend_weights.y * g_face_textures[tex_index].Sample(g_texture_sampler, float3(input.uvw.zx, 1)).xyz;
     texel_rgb += input.face_blend_weights.z * g_face_textures[tex_index].Sample(g_texture_sampler, float3(input.uvw.xy, 2)).xyz;
@@ -108,3 +126,92 @@ float4 AsteroidPS(PSInput input) : SV_TARGET
 
     return ColorLinearToSrgb((ambient_color + diffuse_color + specular_color) * fading_ratio);
 }
+
+PSInput AsteroidVS(VSInput input)
+{
+    return GetAsteroidVertex(input, g_mesh_uniforms.model_matrix,
+                             g_mesh_uniforms.deep_color, g_mesh_uniforms.shallow_color,
+                             g_mesh_uniforms.depth_min, g_mesh_uniforms.depth_max);
+}
+
+float4 AsteroidPS(PSInput input) : SV_TARGET
+{
+    return GetAsteroidColor(input, g_mesh_uniforms.texture_index);
+}
+
+BatchPSInput GetAsteroidInstanceVertex(VSInput input, uint instance_index)
+{
+    const AsteroidInstanceUniforms instance = g_instance_uniforms[instance_index];
+    const float4x4 model_matrix = transpose(float4x4(instance.model_matrix_x, instance.model_matrix_y, instance.model_matrix_z,
+                                                     float4(0.0, 0.0, 0.0, 1.0)));
+
+    BatchPSInput output;
+    output.base          = GetAsteroidVertex(input, model_matrix,
+                                             g_colors_palette[instance.color_indices & 0xFFFF].xyz,
+                                             g_colors_palette[instance.color_indices >> 16].xyz,
+                                             instance.depth_min, instance.depth_max);
+    output.texture_index = instance.texture_index;
+    return output;
+}
+
+// Instanced batch rendering: uniforms of all instances of the mesh subset are fetched from structured buffer
+// by instance id with the batch base offset, since SV_InstanceID does not include start instance location
+BatchPSInput AsteroidBatchVS(VSInput input, uint instance_id : SV_InstanceID)
+{
+    return GetAsteroidInstanceVertex(input, g_batch_constants.instance_offset + instance_id);
+}
+
+// Shared bindings rendering: instance index is fetched from per-instance vertex stream of consecutive indices,
+// which is offset by start instance location of the draw call in all APIs, unlike SV_InstanceID
+BatchPSInput AsteroidSharedVS(SharedVSInput input)
+{
+    VSInput vertex_input;
+    vertex_input.position = input.position;
+    vertex_input.normal   = input.normal;
+    return GetAsteroidInstanceVertex(vertex_input, input.instance_index);
+}
+
+float4 AsteroidBatchPS(BatchPSInput input) : SV_TARGET
+{
+    return GetAsteroidColor(input.base, input.texture_index);
+}
+
+// Rotation matrix around unit axis for row vectors (Rodrigues formula) in the same convention as HLSL++ rotation_axis and rotation_y
+// matrices used on CPU, so that positive angle rotates X axis towards Y around Z axis and towards -Z around Y axis
+float4x4 GetAxisRotationMatrix(float3 axis, float angle)
+{
+    float sin_angle, cos_angle;
+    sincos(angle, sin_angle, cos_angle);
+    const float  one_minus_cos = 1.0 - cos_angle;
+    const float3 sin_axis      = axis * sin_angle;
+    const float3 row_x         = axis.x * axis * one_minus_cos + float3(cos_angle,   sin_axis.z, -sin_axis.y);
+    const float3 row_y         = axis.y * axis * one_minus_cos + float3(-sin_axis.z, cos_angle,   sin_axis.x);
+    const float3 row_z         = axis.z * axis * one_minus_cos + float3(sin_axis.y,  -sin_axis.x, cos_angle);
+    return float4x4(float4(row_x, 0.0), float4(row_y, 0.0), float4(row_z, 0.0), float4(0.0, 0.0, 0.0, 1.0));
+}
+
+// GPU motion rendering: model matrix is evaluated from static motion parameters of the asteroid at the elapsed time,
+// since spin and orbit rotations around fixed axes are accumulated to the model matrix at zero time
+BatchPSInput AsteroidMotionVS(VSInput input, uint instance_id : SV_InstanceID)
+{
+    const AsteroidMotionUniforms motion = g_motion_uniforms[g_instance_indices[g_batch_constants.instance_offset + instance_id]];
+    const float    elapsed_radians   = g_batch_constants.elapsed_radians;
+    const float    spin_speed        = length(motion.angular_velocity.xyz);
+    const float3   spin_axis         = spin_speed > 0.0 ? motion.angular_velocity.xyz / spin_speed : float3(0.0, 1.0, 0.0);
+    const float4x4 spin_matrix       = GetAxisRotationMatrix(spin_axis, spin_speed * elapsed_radians);
+    const float4x4 orbit_matrix      = GetAxisRotationMatrix(float3(0.0, 1.0, 0.0), motion.angular_velocity.w * elapsed_radians);
+    const float4x4 init_model_matrix = transpose(float4x4(motion.model_matrix_x, motion.model_matrix_y, motion.model_matrix_z,
+                                                          float4(0.0, 0.0, 0.0, 1.0)));
+    const float4x4 model_matrix      = mul(mul(spin_matrix, init_model_matrix), orbit_matrix);
+    const uint     color_indices     = g_batch_constants.lod_color_indices != 0xFFFFFFFF
+                                     ? g_batch_constants.lod_color_indices
+                                     : motion.color_indices;
+
+    BatchPSInput output;
+    output.base          = GetAsteroidVertex(input, model_matrix,
+                                             g_colors_palette[color_indices & 0xFFFF].xyz,
+                                             g_colors_palette[color_indices >> 16].xyz,
+                                             g_batch_constants.depth_min, g_batch_constants.depth_max);
+    output.texture_index = motion.texture_index;
+    return output;
+}
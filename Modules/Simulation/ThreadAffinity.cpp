@@ -0,0 +1,341 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: ThreadAffinity.cpp
+Placement of parallel executor worker threads on CPU cores and NUMA nodes
+with per-node partitioning of parallel loops and chunked parallel loops shared by simulation modules.
+
+******************************************************************************/
+
+#include "ThreadAffinity.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/algorithm/for_each.hpp>
+#include <fmt/format.h>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <fstream>
+#include <sstream>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace Methane::Samples
+{
+
+static constexpr uint32_t g_chunks_per_worker = 8U;
+
+#if defined(__linux__)
+
+// Parses CPU list in the Linux sysfs format, like "0-7,16-23"
+[[nodiscard]]
+static ThreadAffinity::CpuIndices ParseCpuList(const std::string& cpu_list)
+{
+    ThreadAffinity::CpuIndices cpu_indices;
+    std::istringstream cpu_list_stream(cpu_list);
+    std::string cpu_range;
+    while (std::getline(cpu_list_stream, cpu_range, ','))
+    {
+        uint32_t first_cpu = 0U;
+        uint32_t last_cpu  = 0U;
+        char     separator = 0;
+        std::istringstream cpu_range_stream(cpu_range);
+        if (!(cpu_range_stream >> first_cpu))
+            continue;
+
+        last_cpu = (cpu_range_stream >> separator >> last_cpu) && separator == '-' ? last_cpu : first_cpu;
+        for (uint32_t cpu_index = first_cpu; cpu_index <= last_cpu; ++cpu_index)
+        {
+            cpu_indices.push_back(cpu_index);
+        }
+    }
+    return cpu_indices;
+}
+
+#endif
+
+ThreadAffinity::NodeCpuIndices ThreadAffinity::GetNumaNodeCpus()
+{
+    META_FUNCTION_TASK();
+    NodeCpuIndices node_cpus;
+
+#if defined(__linux__)
+    for (uint32_t node_index = 0U;; ++node_index)
+    {
+        std::ifstream cpu_list_file(fmt::format("/sys/devices/system/node/node{}/cpulist", node_index));
+        if (!cpu_list_file.is_open())
+            break;
+
+        std::string cpu_list;
+        std::getline(cpu_list_file, cpu_list);
+        if (CpuIndices cpu_indices = ParseCpuList(cpu_list);
+            !cpu_indices.empty())
+        {
+            node_cpus.emplace_back(std::move(cpu_indices));
+        }
+    }
+#elif defined(_WIN32)
+    ULONG highest_node_number = 0U;
+    if (GetNumaHighestNodeNumber(&highest_node_number))
+    {
+        for (ULONG node_number = 0U; node_number <= highest_node_number; ++node_number)
+        {
+            GROUP_AFFINITY group_affinity{};
+            if (!GetNumaNodeProcessorMaskEx(static_cast<USHORT>(node_number), &group_affinity))
+                continue;
+
+            CpuIndices cpu_indices;
+            for (uint32_t bit_index = 0U; bit_index < sizeof(KAFFINITY) * 8U; ++bit_index)
+            {
+                if (group_affinity.Mask & (static_cast<KAFFINITY>(1U) << bit_index))
+                    cpu_indices.push_back(static_cast<uint32_t>(group_affinity.Group) * sizeof(KAFFINITY) * 8U + bit_index);
+            }
+            if (!cpu_indices.empty())
+                node_cpus.emplace_back(std::move(cpu_indices));
+        }
+    }
+#endif
+
+    if (node_cpus.empty())
+    {
+        CpuIndices& cpu_indices = node_cpus.emplace_back(std::max(1U, std::thread::hardware_concurrency()));
+        for (uint32_t cpu_index = 0U; cpu_index < cpu_indices.size(); ++cpu_index)
+        {
+            cpu_indices[cpu_index] = cpu_index;
+        }
+    }
+    return node_cpus;
+}
+
+std::string_view ThreadAffinity::GetModeName(Mode mode)
+{
+    META_FUNCTION_TASK();
+    switch (mode)
+    {
+    case Mode::None:      return "None";
+    case Mode::Cores:     return "Cores";
+    case Mode::NumaNodes: return "NUMA Nodes";
+    default:              META_UNEXPECTED_RETURN(mode, "");
+    }
+}
+
+bool ThreadAffinity::PinCurrentThread(const CpuIndices& cpu_indices)
+{
+    META_FUNCTION_TASK();
+    if (cpu_indices.empty())
+        return false;
+
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const uint32_t cpu_index : cpu_indices)
+    {
+        if (cpu_index < CPU_SETSIZE)
+            CPU_SET(cpu_index, &cpu_set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) == 0;
+#elif defined(_WIN32)
+    // Thread affinity is limited to one processor group, so CPUs of the group of the first CPU are used
+    constexpr uint32_t group_cpus_count = sizeof(KAFFINITY) * 8U;
+    GROUP_AFFINITY group_affinity{};
+    group_affinity.Group = static_cast<WORD>(cpu_indices.front() / group_cpus_count);
+    for (const uint32_t cpu_index : cpu_indices)
+    {
+        if (cpu_index / group_cpus_count == group_affinity.Group)
+            group_affinity.Mask |= static_cast<KAFFINITY>(1U) << (cpu_index % group_cpus_count);
+    }
+    return SetThreadGroupAffinity(GetCurrentThread(), &group_affinity, nullptr) != 0;
+#else
+    // Thread affinity can not be set on MacOS, where scheduler accepts only affinity tag hints
+    return false;
+#endif
+}
+
+ThreadAffinity::ThreadAffinity(tf::Executor& executor, Mode mode)
+    : m_executor(executor)
+    , m_mode(mode)
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("ThreadAffinity::ThreadAffinity");
+
+    const NodeCpuIndices node_cpus     = GetNumaNodeCpus();
+    const auto           nodes_count   = static_cast<uint32_t>(node_cpus.size());
+    const auto           workers_count = static_cast<uint32_t>(m_executor.num_workers());
+
+    // CPUs are assigned to workers node by node, so that consecutive workers share the same node
+    std::vector<CpuIndices> worker_cpus(workers_count);
+    m_node_by_worker_id.resize(workers_count, 0U);
+    m_node_workers_count.resize(mode == Mode::None ? 1U : nodes_count, 0U);
+    if (mode == Mode::Cores)
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> node_cpu_pairs;
+        for (uint32_t node_index = 0U; node_index < nodes_count; ++node_index)
+        {
+            for (const uint32_t cpu_index : node_cpus[node_index])
+                node_cpu_pairs.emplace_back(node_index, cpu_index);
+        }
+        for (uint32_t worker_id = 0U; worker_id < workers_count; ++worker_id)
+        {
+            const auto& [node_index, cpu_index] = node_cpu_pairs[worker_id % node_cpu_pairs.size()];
+            worker_cpus[worker_id]         = { cpu_index };
+            m_node_by_worker_id[worker_id] = node_index;
+        }
+    }
+    else if (mode == Mode::NumaNodes)
+    {
+        for (uint32_t worker_id = 0U; worker_id < workers_count; ++worker_id)
+        {
+            const uint32_t node_index = worker_id * nodes_count / workers_count;
+            worker_cpus[worker_id]         = node_cpus[node_index];
+            m_node_by_worker_id[worker_id] = node_index;
+        }
+    }
+    for (const uint32_t node_index : m_node_by_worker_id)
+    {
+        m_node_workers_count[node_index]++;
+    }
+
+    if (mode == Mode::None || !workers_count)
+        return;
+
+    // Every worker takes exactly one pinning task, because started tasks wait until all workers have started theirs
+    std::atomic<uint32_t> started_workers_count{ 0U };
+    std::atomic<uint32_t> pinned_workers_count{ 0U };
+    tf::Taskflow pin_task_flow;
+    for (uint32_t task_index = 0U; task_index < workers_count; ++task_index)
+    {
+        pin_task_flow.emplace([this, &worker_cpus, &started_workers_count, &pinned_workers_count, workers_count]()
+        {
+            started_workers_count++;
+            while (started_workers_count < workers_count)
+            {
+                std::this_thread::yield();
+            }
+
+            const int worker_id = m_executor.this_worker_id();
+            if (worker_id >= 0 && static_cast<uint32_t>(worker_id) < workers_count &&
+                PinCurrentThread(worker_cpus[static_cast<uint32_t>(worker_id)]))
+            {
+                pinned_workers_count++;
+            }
+        });
+    }
+    m_executor.run(pin_task_flow).get();
+    m_pinned_workers_count = pinned_workers_count;
+}
+
+uint32_t ThreadAffinity::GetCurrentNode() const
+{
+    const int worker_id = m_executor.this_worker_id();
+    return worker_id >= 0 && static_cast<size_t>(worker_id) < m_node_by_worker_id.size()
+         ? m_node_by_worker_id[static_cast<size_t>(worker_id)]
+         : 0U;
+}
+
+uint32_t ThreadAffinity::GetChunkSize(const tf::Executor& executor, uint32_t indices_count)
+{
+    META_FUNCTION_TASK();
+    const uint32_t workers_count = std::max(1U, static_cast<uint32_t>(executor.num_workers()));
+    return std::max(1U, indices_count / (workers_count * g_chunks_per_worker));
+}
+
+void ThreadAffinity::ForEachIndexRange(tf::Executor& executor, uint32_t indices_count, const IndexRangeFunc& range_func)
+{
+    META_FUNCTION_TASK();
+    if (!indices_count)
+        return;
+
+    const uint32_t chunk_size   = GetChunkSize(executor, indices_count);
+    const uint32_t chunks_count = (indices_count + chunk_size - 1U) / chunk_size;
+
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, chunks_count, 1U,
+        [&range_func, indices_count, chunk_size](const uint32_t chunk_index)
+        {
+            const uint32_t begin_index = chunk_index * chunk_size;
+            range_func(begin_index, std::min(begin_index + chunk_size, indices_count));
+        }
+    );
+    executor.run(task_flow).get();
+}
+
+void ThreadAffinity::ForEachIndexRange(uint32_t indices_count, const IndexRangeFunc& range_func) const
+{
+    META_FUNCTION_TASK();
+    if (!indices_count)
+        return;
+
+    const uint32_t nodes_count   = GetNodesCount();
+    const uint32_t workers_count = std::max(1U, GetWorkersCount());
+    const uint32_t chunk_size    = GetChunkSize(m_executor, indices_count);
+
+    std::vector<uint32_t> partition_begin_indices(nodes_count + 1U, indices_count);
+    partition_begin_indices[0] = 0U;
+    uint32_t partition_workers_count = 0U;
+    for (uint32_t node_index = 0U; node_index < nodes_count; ++node_index)
+    {
+        partition_workers_count += m_node_workers_count[node_index];
+        partition_begin_indices[node_index + 1U] = static_cast<uint32_t>(static_cast<uint64_t>(indices_count) * partition_workers_count / workers_count);
+    }
+
+    std::vector<std::atomic<uint32_t>> next_chunk_indices(nodes_count);
+    for (uint32_t node_index = 0U; node_index < nodes_count; ++node_index)
+    {
+        next_chunk_indices[node_index] = partition_begin_indices[node_index];
+    }
+
+    tf::Taskflow task_flow;
+    for (uint32_t task_index = 0U; task_index < workers_count; ++task_index)
+    {
+        task_flow.emplace([this, &range_func, &partition_begin_indices, &next_chunk_indices, nodes_count, chunk_size]()
+        {
+            const uint32_t current_node_index = GetCurrentNode();
+            for (uint32_t node_offset = 0U; node_offset < nodes_count; ++node_offset)
+            {
+                const uint32_t node_index          = (current_node_index + node_offset) % nodes_count;
+                const uint32_t partition_end_index = partition_begin_indices[node_index + 1U];
+                for (uint32_t begin_index = next_chunk_indices[node_index].fetch_add(chunk_size);
+                     begin_index < partition_end_index;
+                     begin_index = next_chunk_indices[node_index].fetch_add(chunk_size))
+                {
+                    range_func(begin_index, std::min(begin_index + chunk_size, partition_end_index));
+                }
+            }
+        });
+    }
+    m_executor.run(task_flow).get();
+}
+
+std::string ThreadAffinity::GetDescription() const
+{
+    META_FUNCTION_TASK();
+    return fmt::format("{}, {} of {} workers pinned on {} node(s)",
+                       GetModeName(m_mode), m_pinned_workers_count, GetWorkersCount(), GetNodesCount());
+}
+
+} // namespace Methane::Samples
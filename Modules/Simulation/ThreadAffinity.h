@@ -0,0 +1,94 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: ThreadAffinity.h
+Placement of parallel executor worker threads on CPU cores and NUMA nodes
+with per-node partitioning of parallel loops and chunked parallel loops shared by simulation modules.
+
+******************************************************************************/
+
+#pragma once
+
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <cstdint>
+
+namespace Methane::Samples
+{
+
+class ThreadAffinity
+{
+public:
+    enum class Mode : uint32_t
+    {
+        None = 0U, // default OS scheduling of executor workers
+        Cores,     // every worker is pinned to its own logical core, cores are taken node by node
+        NumaNodes  // workers are evenly distributed between NUMA nodes and pinned to all cores of their node
+    };
+
+    using CpuIndices     = std::vector<uint32_t>;
+    using NodeCpuIndices = std::vector<CpuIndices>;
+    using IndexRangeFunc = std::function<void(uint32_t begin_index, uint32_t end_index)>;
+
+    // Logical CPU indices of every NUMA node, single node with all hardware threads when topology is not available
+    [[nodiscard]] static NodeCpuIndices GetNumaNodeCpus();
+    [[nodiscard]] static std::string_view GetModeName(Mode mode);
+
+    // Returns false when thread affinity is not supported by platform
+    static bool PinCurrentThread(const CpuIndices& cpu_indices);
+
+    // Parallel loops are split in several chunks per executor worker, so that uneven chunks are balanced between workers
+    // and instrumentation reports one zone per chunk instead of per item
+    [[nodiscard]] static uint32_t GetChunkSize(const tf::Executor& executor, uint32_t indices_count);
+
+    // Index range is split in chunks of GetChunkSize, which are processed by executor workers without node partitioning,
+    // so that chunk index of the range is its begin index divided by chunk size
+    static void ForEachIndexRange(tf::Executor& executor, uint32_t indices_count, const IndexRangeFunc& range_func);
+
+    // All executor workers are pinned at once, so executor must be idle and it must not be called from its worker thread
+    ThreadAffinity(tf::Executor& executor, Mode mode);
+
+    [[nodiscard]] tf::Executor& GetExecutor() const noexcept           { return m_executor; }
+    [[nodiscard]] Mode          GetMode() const noexcept               { return m_mode; }
+    [[nodiscard]] uint32_t      GetNodesCount() const noexcept         { return static_cast<uint32_t>(m_node_workers_count.size()); }
+    [[nodiscard]] uint32_t      GetWorkersCount() const noexcept       { return static_cast<uint32_t>(m_node_by_worker_id.size()); }
+    [[nodiscard]] uint32_t      GetPinnedWorkersCount() const noexcept { return m_pinned_workers_count; }
+
+    // NUMA node of the current executor worker thread, zero for threads outside of executor
+    [[nodiscard]] uint32_t GetCurrentNode() const;
+
+    // Index range is split in contiguous partitions per NUMA node in proportion to node workers count:
+    // workers process chunks of their node partition first and take chunks of other partitions when it is done,
+    // so that the same items are processed on the same node from frame to frame
+    void ForEachIndexRange(uint32_t indices_count, const IndexRangeFunc& range_func) const;
+
+    [[nodiscard]] std::string GetDescription() const;
+
+private:
+    tf::Executor&         m_executor;
+    const Mode            m_mode;
+    std::vector<uint32_t> m_node_by_worker_id;
+    std::vector<uint32_t> m_node_workers_count;
+    uint32_t              m_pinned_workers_count = 0U;
+};
+
+} // namespace Methane::Samples
@@ -0,0 +1,181 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidCollisionsTests.cpp
+Tests of asteroid collisions spatial hash broad phase and narrow phase
+against brute-force detection of overlapping bounding spheres.
+
+******************************************************************************/
+
+#include "AsteroidsTestParameters.h"
+
+#include <AsteroidCollisions.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <random>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+
+using namespace Methane::Samples;
+
+using Pair  = std::pair<uint32_t, uint32_t>;
+using Pairs = std::vector<Pair>;
+
+static AsteroidCollisions::Events GetBruteForceEvents(const AsteroidCollisions::BoundingSpheres& bounding_spheres)
+{
+    AsteroidCollisions::Events events;
+    const auto bodies_count = static_cast<uint32_t>(bounding_spheres.size());
+    for (uint32_t first_index = 0U; first_index < bodies_count; ++first_index)
+    {
+        for (uint32_t second_index = first_index + 1U; second_index < bodies_count; ++second_index)
+        {
+            const hlslpp::float4& first_sphere  = bounding_spheres[first_index];
+            const hlslpp::float4& second_sphere = bounding_spheres[second_index];
+            const hlslpp::float3  centers_offset(second_sphere.xyz - first_sphere.xyz);
+            const float           radii_sum        = static_cast<float>(first_sphere.w + second_sphere.w);
+            const float           centers_distance = std::sqrt(static_cast<float>(hlslpp::dot(centers_offset, centers_offset)));
+            if (centers_distance < radii_sum)
+                events.push_back(AsteroidCollisions::Event{ first_index, second_index, radii_sum - centers_distance });
+        }
+    }
+    return events;
+}
+
+static Pairs GetSortedPairs(const AsteroidCollisions::Events& events)
+{
+    Pairs pairs;
+    pairs.reserve(events.size());
+    for (const AsteroidCollisions::Event& event : events)
+    {
+        pairs.emplace_back(event.first_index, event.second_index);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST_CASE("Asteroid collisions broad phase finds pairs across cell boundaries", "[collisions]")
+{
+    // Unit radius spheres are hashed to cells of size 2, so every pair straddles the cell boundary at even coordinates
+    const AsteroidCollisions::BoundingSpheres bounding_spheres{
+        hlslpp::float4(-0.1F,  0.F,   0.F,   1.F), // 0-1 across boundary at zero, where cell coordinates change sign
+        hlslpp::float4( 0.1F,  0.F,   0.F,   1.F),
+        hlslpp::float4( 10.F,  1.9F,  10.F,  1.F), // 2-3 across boundary along Y axis
+        hlslpp::float4( 10.F,  2.1F,  10.F,  1.F),
+        hlslpp::float4(-20.F, -20.F, -3.9F,  1.F), // 4-5 across boundary along Z axis in negative cells
+        hlslpp::float4(-20.F, -20.F, -4.1F,  1.F),
+        hlslpp::float4( 29.9F, 29.9F, 29.9F, 1.F), // 6-7 across cell corner to the diagonal neighbour cell
+        hlslpp::float4( 30.1F, 30.1F, 30.1F, 1.F),
+        hlslpp::float4( 50.F,  50.F,  50.F,  1.F), // 8-9 in neighbour cells, but not overlapping
+        hlslpp::float4( 52.5F, 50.F,  50.F,  1.F),
+    };
+
+    AsteroidCollisions collisions;
+    const AsteroidCollisions::Events& events = collisions.Detect(GetTestExecutor(), bounding_spheres);
+
+    CHECK(GetSortedPairs(events) == Pairs{ { 0U, 1U }, { 2U, 3U }, { 4U, 5U }, { 6U, 7U } });
+    CHECK(collisions.GetStatistics().events_count == 4U);
+    CHECK(collisions.GetStatistics().cell_size == 2.F);
+    for (const AsteroidCollisions::Event& event : events)
+    {
+        CHECK(event.first_index < event.second_index);
+    }
+}
+
+TEST_CASE("Asteroid collisions broad phase reports pairs once when neighbour cells share hash bucket", "[collisions]")
+{
+    // Few bodies are hashed to only a few buckets, so most of 27 neighbour cells collide in the same buckets
+    SECTION("Two bodies in neighbour cells")
+    {
+        const AsteroidCollisions::BoundingSpheres bounding_spheres{
+            hlslpp::float4(1.9F, 1.9F, 1.9F, 1.F),
+            hlslpp::float4(2.1F, 2.1F, 2.1F, 1.F),
+        };
+
+        AsteroidCollisions collisions;
+        const AsteroidCollisions::Events& events = collisions.Detect(GetTestExecutor(), bounding_spheres);
+
+        CHECK(collisions.GetStatistics().buckets_count == 4U);
+        CHECK(collisions.GetStatistics().candidate_pairs_count == 1U);
+        REQUIRE(events.size() == 1U);
+        CHECK(events.front().first_index == 0U);
+        CHECK(events.front().second_index == 1U);
+        CHECK_THAT(events.front().penetration_depth, Catch::Matchers::WithinAbs(2.F - std::sqrt(3.F * 0.2F * 0.2F), 1E-5F));
+    }
+
+    SECTION("Cluster of bodies around the cell corner")
+    {
+        AsteroidCollisions::BoundingSpheres bounding_spheres;
+        for (uint32_t corner_index = 0U; corner_index < 8U; ++corner_index)
+        {
+            bounding_spheres.emplace_back((corner_index & 1U) ? 0.2F : -0.2F,
+                                          (corner_index & 2U) ? 0.2F : -0.2F,
+                                          (corner_index & 4U) ? 0.2F : -0.2F,
+                                          1.F);
+        }
+
+        AsteroidCollisions collisions;
+        const AsteroidCollisions::Events& events = collisions.Detect(GetTestExecutor(), bounding_spheres);
+
+        const Pairs pairs = GetSortedPairs(events);
+        CHECK(std::adjacent_find(pairs.begin(), pairs.end()) == pairs.end());
+        CHECK(pairs.size() == 8U * 7U / 2U);
+        CHECK(collisions.GetStatistics().candidate_pairs_count == 8U * 7U / 2U);
+    }
+}
+
+TEST_CASE("Asteroid collisions match brute-force detection on seeded random field", "[collisions]")
+{
+    std::mt19937 rng(1123U);
+    std::uniform_real_distribution<float> position_distribution(-40.F, 40.F);
+    std::uniform_real_distribution<float> radius_distribution(0.1F, 1.2F);
+
+    AsteroidCollisions::BoundingSpheres bounding_spheres;
+    for (uint32_t body_index = 0U; body_index < 3000U; ++body_index)
+    {
+        // Field is flattened along Y axis like the asteroids belt, so that cells are densely populated
+        const float position_x = position_distribution(rng);
+        const float position_y = position_distribution(rng) / 4.F;
+        const float position_z = position_distribution(rng);
+        bounding_spheres.emplace_back(position_x, position_y, position_z, radius_distribution(rng));
+    }
+
+    const AsteroidCollisions::Events reference_events = GetBruteForceEvents(bounding_spheres);
+    REQUIRE_FALSE(reference_events.empty());
+
+    // Detection is repeated to check that chunk buffers kept between ticks do not leak pairs of the previous detection
+    AsteroidCollisions collisions;
+    for (uint32_t detection_index = 0U; detection_index < 2U; ++detection_index)
+    {
+        AsteroidCollisions::Events events = collisions.Detect(GetTestExecutor(), bounding_spheres);
+        REQUIRE(GetSortedPairs(events) == GetSortedPairs(reference_events));
+        CHECK(collisions.GetStatistics().events_count == reference_events.size());
+
+        std::sort(events.begin(), events.end(),
+                  [](const AsteroidCollisions::Event& left, const AsteroidCollisions::Event& right)
+                  { return std::make_pair(left.first_index, left.second_index) < std::make_pair(right.first_index, right.second_index); });
+        for (size_t event_index = 0U; event_index < events.size(); ++event_index)
+        {
+            CHECK_THAT(events[event_index].penetration_depth,
+                       Catch::Matchers::WithinAbs(reference_events[event_index].penetration_depth, 1E-4F));
+        }
+    }
+}
@@ -0,0 +1,180 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsGravityTests.cpp
+Tests of Barnes-Hut gravity accelerations against direct summation
+and of perturbation bounds used by orbital index queries.
+
+******************************************************************************/
+
+#include "AsteroidsTestParameters.h"
+#include "AsteroidsLinearScan.h"
+
+#include <AsteroidsGravity.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <array>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+using namespace Methane::Samples;
+
+constexpr uint32_t g_test_asteroids_count = 1500U;
+
+// Gravity constant is large, so that mutual gravity is not lost in rounding errors of the planet gravity towards orbits
+constexpr float g_test_gravity_constant = 1.F;
+
+// Relative RMS error of mutual gravity accelerations computed with octree against direct summation of all pairs in double precision
+static double GetGravityAccelerationsError(const TestParameters& parameters, float theta)
+{
+    AsteroidsGravity gravity(AsteroidsGravity::Settings{ .theta = theta, .gravity_constant = g_test_gravity_constant });
+    gravity.Reset(GetTestExecutor(), parameters, 0.0);
+
+    const AsteroidsGravity::Positions& positions     = gravity.GetPositions();
+    const AsteroidsGravity::Positions& accelerations = gravity.GetAccelerations();
+    const double                       softening_sq  = gravity.GetSettings().softening_length * gravity.GetSettings().softening_length;
+
+    double error_sq_sum     = 0.0;
+    double reference_sq_sum = 0.0;
+    for (uint32_t body_index = 0U; body_index < parameters.size(); ++body_index)
+    {
+        const Asteroid::Parameters& body_parameters = parameters[body_index];
+        const hlslpp::float3&       body_position   = positions[body_index];
+        std::array<double, 3> reference_acceleration{ 0.0, 0.0, 0.0 };
+        for (uint32_t other_index = 0U; other_index < parameters.size(); ++other_index)
+        {
+            const hlslpp::float3& other_position = positions[other_index];
+            const double          mass           = std::pow(static_cast<double>(parameters[other_index].scale), 3.0);
+            const double          offset_x       = static_cast<double>(static_cast<float>(other_position.x)) - static_cast<float>(body_position.x);
+            const double          offset_y       = static_cast<double>(static_cast<float>(other_position.y)) - static_cast<float>(body_position.y);
+            const double          offset_z       = static_cast<double>(static_cast<float>(other_position.z)) - static_cast<float>(body_position.z);
+            const double          factor         = g_test_gravity_constant * mass
+                                                 / std::pow(offset_x * offset_x + offset_y * offset_y + offset_z * offset_z + softening_sq, 1.5);
+            reference_acceleration[0] += offset_x * factor;
+            reference_acceleration[1] += offset_y * factor;
+            reference_acceleration[2] += offset_z * factor;
+        }
+
+        // Planet gravity towards unperturbed orbit is added back to get mutual gravity part of the integrated acceleration
+        const float          angular_speed = body_parameters.orbit_speed * static_cast<float>(std::numbers::pi);
+        const auto           orbit_height  = static_cast<float>(body_parameters.scale_translate_matrix._m31);
+        const hlslpp::float3 orbit_offset(body_position.x, static_cast<float>(body_position.y) - orbit_height, body_position.z);
+        const hlslpp::float3 acceleration(accelerations[body_index] + orbit_offset * angular_speed * angular_speed);
+        const std::array<double, 3> acceleration_components{
+            static_cast<float>(acceleration.x),
+            static_cast<float>(acceleration.y),
+            static_cast<float>(acceleration.z)
+        };
+        for (uint32_t axis_index = 0U; axis_index < 3U; ++axis_index)
+        {
+            const double error = acceleration_components[axis_index] - reference_acceleration[axis_index];
+            error_sq_sum     += error * error;
+            reference_sq_sum += reference_acceleration[axis_index] * reference_acceleration[axis_index];
+        }
+    }
+
+    REQUIRE(reference_sq_sum > 0.0);
+    return std::sqrt(error_sq_sum / reference_sq_sum);
+}
+
+// Perturbed position is compared with the unperturbed orbit circle in the same way as orbital index compares it with orbit bands
+static float GetOrbitCircleDistance(const Asteroid::Parameters& asteroid_parameters, const hlslpp::float3& position)
+{
+    const hlslpp::float4x4& scale_translate = asteroid_parameters.scale_translate_matrix;
+    const float orbit_radius    = std::hypot(static_cast<float>(scale_translate._m30), static_cast<float>(scale_translate._m32));
+    const float position_radius = std::hypot(static_cast<float>(position.x), static_cast<float>(position.z));
+    return std::hypot(position_radius - orbit_radius, static_cast<float>(position.y) - static_cast<float>(scale_translate._m31));
+}
+
+TEST_CASE("Asteroids gravity accelerations converge to direct summation with decreasing theta", "[gravity]")
+{
+    const TestParameters parameters = GenerateTestParameters(g_test_asteroids_count, g_test_mesh_count, 1123U);
+
+    // Zero opening angle opens every octree node, so all pairs are summed exactly up to float rounding
+    const double exact_error  = GetGravityAccelerationsError(parameters, 0.F);
+    const double fine_error   = GetGravityAccelerationsError(parameters, 0.3F);
+    const double coarse_error = GetGravityAccelerationsError(parameters, 0.7F);
+    CAPTURE(exact_error, fine_error, coarse_error);
+
+    CHECK(exact_error < 1E-4);
+    CHECK(fine_error < 1E-2);
+    CHECK(exact_error <= fine_error);
+    CHECK(fine_error <= coarse_error);
+}
+
+TEST_CASE("Asteroids gravity perturbation bounds contain perturbed positions", "[gravity]")
+{
+    const TestParameters                         parameters        = GenerateTestParameters(g_test_asteroids_count, g_test_mesh_count, 2311U);
+    const AsteroidsOrbitalIndex::MeshDepthMaxima mesh_depth_maxima = GetTestMeshDepthMaxima();
+    const AsteroidsOrbitalIndex                  orbital_index(parameters, mesh_depth_maxima);
+
+    // Gravity is integrated for a few seconds, so that perturbations are comparable to asteroid sizes
+    AsteroidsGravity gravity(AsteroidsGravity::Settings{ .gravity_constant = g_test_gravity_constant });
+    gravity.Reset(GetTestExecutor(), parameters, 0.0);
+    const double step_seconds = gravity.GetStepSeconds();
+    for (uint32_t step_index = 1U; step_index <= 41U; ++step_index)
+    {
+        gravity.Update(GetTestExecutor(), static_cast<double>(step_index) * step_seconds);
+    }
+
+    const AsteroidsOrbitalIndex::PerturbationBounds band_bounds = orbital_index.GetBandPerturbationBounds(gravity.GetPerturbationBounds());
+    REQUIRE(band_bounds.size() == orbital_index.GetBandsCount());
+
+    // Queries are made inside of the extrapolation window, before and after it
+    const double window_step_ratio = GENERATE(0.0, 0.5, 1.0, -1.0, 3.0);
+    const double elapsed_seconds   = gravity.GetTime() + window_step_ratio * step_seconds;
+    CAPTURE(window_step_ratio);
+
+    const AsteroidsOrbitalIndex::Perturbation perturbation{
+        .band_bounds_ptr      = &band_bounds,
+        .window_begin_seconds = gravity.GetTime(),
+        .window_end_seconds   = gravity.GetTime() + step_seconds,
+        .get_position         = [&gravity, elapsed_seconds](uint32_t asteroid_index) { return gravity.GetPosition(asteroid_index, elapsed_seconds); }
+    };
+
+    AsteroidCollisions::BoundingSpheres bounding_spheres;
+    float max_perturbation = 0.F;
+    for (const Asteroid::Parameters& asteroid_parameters : parameters)
+    {
+        const hlslpp::float3                            position        = gravity.GetPosition(asteroid_parameters.index, elapsed_seconds);
+        const AsteroidsOrbitalIndex::PerturbationBound& asteroid_bound  = gravity.GetPerturbationBounds()[asteroid_parameters.index];
+        const float                                     orbit_distance  = GetOrbitCircleDistance(asteroid_parameters, position);
+        const double                                    outside_seconds = std::max({ gravity.GetTime() - elapsed_seconds,
+                                                                                     elapsed_seconds - gravity.GetTime() - step_seconds, 0.0 });
+        CHECK(orbit_distance <= asteroid_bound.distance + asteroid_bound.speed * static_cast<float>(outside_seconds) + 1E-3F);
+
+        max_perturbation = std::max(max_perturbation, orbit_distance);
+        bounding_spheres.push_back(AsteroidCollisions::GetBoundingSphere(asteroid_parameters, position,
+                                                                         mesh_depth_maxima[asteroid_parameters.mesh_instance_index]));
+    }
+    CHECK(max_perturbation > 0.1F);
+
+    const AsteroidsLinearScan linear_scan(std::move(bounding_spheres));
+    const hlslpp::float3      eye_position(-110.F, 75.F, 210.F);
+    for (uint32_t asteroid_index = 0U; asteroid_index < g_test_asteroids_count; asteroid_index += 29U)
+    {
+        const hlslpp::float3 asteroid_position(linear_scan.GetBoundingSpheres()[asteroid_index].xyz);
+        const AsteroidsOrbitalIndex::Ray ray{ eye_position, asteroid_position - eye_position };
+        CheckHit(orbital_index.Pick(ray, elapsed_seconds, &perturbation), linear_scan.Pick(ray));
+        CHECK(orbital_index.QueryNear(asteroid_position, 3.F, elapsed_seconds, &perturbation) == linear_scan.QueryNear(asteroid_position, 3.F));
+    }
+}
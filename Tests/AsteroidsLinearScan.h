@@ -0,0 +1,100 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsLinearScan.h
+Linear scan of asteroid bounding spheres used as reference of orbital index queries in tests.
+
+******************************************************************************/
+
+#pragma once
+
+#include <AsteroidsOrbitalIndex.h>
+#include <AsteroidCollisions.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <optional>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Samples
+{
+
+class AsteroidsLinearScan
+{
+public:
+    explicit AsteroidsLinearScan(AsteroidCollisions::BoundingSpheres bounding_spheres)
+        : m_bounding_spheres(std::move(bounding_spheres))
+    { }
+
+    [[nodiscard]] const AsteroidCollisions::BoundingSpheres& GetBoundingSpheres() const noexcept { return m_bounding_spheres; }
+
+    [[nodiscard]] std::optional<AsteroidsOrbitalIndex::Hit> Pick(const AsteroidsOrbitalIndex::Ray& ray) const
+    {
+        const hlslpp::float3 direction = hlslpp::normalize(ray.direction);
+        std::optional<AsteroidsOrbitalIndex::Hit> nearest_hit;
+        for (uint32_t asteroid_index = 0U; asteroid_index < m_bounding_spheres.size(); ++asteroid_index)
+        {
+            const hlslpp::float4& bounding_sphere  = m_bounding_spheres[asteroid_index];
+            const hlslpp::float3  center_to_origin = ray.origin - hlslpp::float3(bounding_sphere.xyz);
+            const auto            radius           = static_cast<float>(bounding_sphere.w);
+            const auto            half_b           = static_cast<float>(hlslpp::dot(center_to_origin, direction));
+            const float           c                = static_cast<float>(hlslpp::dot(center_to_origin, center_to_origin)) - radius * radius;
+            const float           discriminant     = half_b * half_b - c;
+            if ((c > 0.F && half_b > 0.F) || discriminant < 0.F)
+                continue;
+
+            const float distance = std::max(0.F, -half_b - std::sqrt(discriminant));
+            if (!nearest_hit || distance < nearest_hit->distance)
+                nearest_hit = AsteroidsOrbitalIndex::Hit{ asteroid_index, distance };
+        }
+        return nearest_hit;
+    }
+
+    [[nodiscard]] AsteroidsOrbitalIndex::Indices QueryNear(const hlslpp::float3& point, float radius) const
+    {
+        AsteroidsOrbitalIndex::Indices asteroid_indices;
+        for (uint32_t asteroid_index = 0U; asteroid_index < m_bounding_spheres.size(); ++asteroid_index)
+        {
+            const hlslpp::float4& bounding_sphere = m_bounding_spheres[asteroid_index];
+            const hlslpp::float3  center_to_point = point - hlslpp::float3(bounding_sphere.xyz);
+            const float           max_distance    = radius + static_cast<float>(bounding_sphere.w);
+            if (static_cast<float>(hlslpp::dot(center_to_point, center_to_point)) <= max_distance * max_distance)
+                asteroid_indices.push_back(asteroid_index);
+        }
+        return asteroid_indices;
+    }
+
+private:
+    AsteroidCollisions::BoundingSpheres m_bounding_spheres;
+};
+
+inline void CheckHit(const std::optional<AsteroidsOrbitalIndex::Hit>& hit, const std::optional<AsteroidsOrbitalIndex::Hit>& reference_hit)
+{
+    REQUIRE(hit.has_value() == reference_hit.has_value());
+    if (!hit)
+        return;
+
+    // Ray origin may be inside of several bounding spheres, which are all hit at zero distance
+    CHECK_THAT(hit->distance, Catch::Matchers::WithinAbs(reference_hit->distance, 1E-3F));
+    CHECK((hit->asteroid_index == reference_hit->asteroid_index || hit->distance == reference_hit->distance));
+}
+
+} // namespace Methane::Samples
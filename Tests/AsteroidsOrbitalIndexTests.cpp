@@ -0,0 +1,122 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsOrbitalIndexTests.cpp
+Tests of asteroids orbital index ray picking and proximity queries
+against linear scan of asteroid positions at several times.
+
+******************************************************************************/
+
+#include "AsteroidsTestParameters.h"
+#include "AsteroidsLinearScan.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <random>
+#include <numbers>
+
+using namespace Methane::Samples;
+
+constexpr uint32_t g_test_asteroids_count = 2000U;
+
+static AsteroidCollisions::BoundingSpheres GetOrbitBoundingSpheres(const TestParameters& parameters,
+                                                                   const AsteroidsOrbitalIndex::MeshDepthMaxima& mesh_depth_maxima,
+                                                                   double elapsed_seconds)
+{
+    const auto elapsed_radians = static_cast<float>(std::numbers::pi * elapsed_seconds);
+    AsteroidCollisions::BoundingSpheres bounding_spheres;
+    for (const Asteroid::Parameters& asteroid_parameters : parameters)
+    {
+        const hlslpp::float4x4& scale_translate = asteroid_parameters.scale_translate_matrix;
+        const hlslpp::float3    position        = AsteroidsOrbitalIndex::GetOrbitPosition(
+            hlslpp::float3(scale_translate._m30, scale_translate._m31, scale_translate._m32),
+            asteroid_parameters.orbit_angle_rad - asteroid_parameters.orbit_speed * elapsed_radians);
+        bounding_spheres.push_back(AsteroidCollisions::GetBoundingSphere(asteroid_parameters, position,
+                                                                         mesh_depth_maxima[asteroid_parameters.mesh_instance_index]));
+    }
+    return bounding_spheres;
+}
+
+static void CheckPick(const AsteroidsOrbitalIndex& orbital_index, const AsteroidsLinearScan& linear_scan,
+                      const AsteroidsOrbitalIndex::Ray& ray, double elapsed_seconds)
+{
+    CheckHit(orbital_index.Pick(ray, elapsed_seconds), linear_scan.Pick(ray));
+}
+
+TEST_CASE("Asteroids orbital index matches linear scan at several times", "[orbital_index]")
+{
+    const double elapsed_seconds = GENERATE(0.0, 1.7, 13.25, 120.5);
+    CAPTURE(elapsed_seconds);
+
+    const TestParameters                         parameters        = GenerateTestParameters(g_test_asteroids_count, g_test_mesh_count, 1123U);
+    const AsteroidsOrbitalIndex::MeshDepthMaxima mesh_depth_maxima = GetTestMeshDepthMaxima();
+    const AsteroidsOrbitalIndex                  orbital_index(parameters, mesh_depth_maxima);
+    const AsteroidsLinearScan                    linear_scan(GetOrbitBoundingSpheres(parameters, mesh_depth_maxima, elapsed_seconds));
+    const AsteroidCollisions::BoundingSpheres&   bounding_spheres  = linear_scan.GetBoundingSpheres();
+    REQUIRE(orbital_index.GetAsteroidsCount() == g_test_asteroids_count);
+
+    std::mt19937 rng(static_cast<uint32_t>(elapsed_seconds * 1000.0));
+    std::uniform_real_distribution<float> offset_distribution(-1.F, 1.F);
+
+    SECTION("Pick rays aimed at asteroids")
+    {
+        const hlslpp::float3 eye_position(-110.F, 75.F, 210.F);
+        for (uint32_t asteroid_index = 0U; asteroid_index < g_test_asteroids_count; asteroid_index += 37U)
+        {
+            const hlslpp::float3 target(bounding_spheres[asteroid_index].xyz);
+            const hlslpp::float3 target_offset(offset_distribution(rng), offset_distribution(rng), offset_distribution(rng));
+            CheckPick(orbital_index, linear_scan, AsteroidsOrbitalIndex::Ray{ eye_position, target + target_offset - eye_position }, elapsed_seconds);
+        }
+    }
+
+    SECTION("Pick rays from inside of the belt, along and across orbit axis")
+    {
+        std::uniform_real_distribution<float> direction_distribution(-1.F, 1.F);
+        for (uint32_t ray_index = 0U; ray_index < 64U; ++ray_index)
+        {
+            const hlslpp::float3 origin(60.F * offset_distribution(rng), 2.F * offset_distribution(rng), 60.F * offset_distribution(rng));
+            const hlslpp::float3 direction(direction_distribution(rng), 0.2F * direction_distribution(rng), direction_distribution(rng));
+            CheckPick(orbital_index, linear_scan, AsteroidsOrbitalIndex::Ray{ origin, direction }, elapsed_seconds);
+        }
+
+        // Vertical rays are parallel to orbit axis, so they intersect band cylinders in infinite ranges or not at all
+        for (uint32_t asteroid_index = 0U; asteroid_index < g_test_asteroids_count; asteroid_index += 101U)
+        {
+            const hlslpp::float4& bounding_sphere = bounding_spheres[asteroid_index];
+            const hlslpp::float3  origin(static_cast<float>(bounding_sphere.x), 50.F, static_cast<float>(bounding_sphere.z));
+            CheckPick(orbital_index, linear_scan, AsteroidsOrbitalIndex::Ray{ origin, hlslpp::float3(0.F, -1.F, 0.F) }, elapsed_seconds);
+        }
+        CheckPick(orbital_index, linear_scan, AsteroidsOrbitalIndex::Ray{ hlslpp::float3(0.F, 50.F, 0.F), hlslpp::float3(0.F, -1.F, 0.F) }, elapsed_seconds);
+    }
+
+    SECTION("Query spheres near asteroids and in empty space")
+    {
+        for (uint32_t asteroid_index = 0U; asteroid_index < g_test_asteroids_count; asteroid_index += 53U)
+        {
+            const hlslpp::float3 point(bounding_spheres[asteroid_index].xyz);
+            CHECK(orbital_index.QueryNear(point, 3.F, elapsed_seconds) == linear_scan.QueryNear(point, 3.F));
+        }
+        for (uint32_t point_index = 0U; point_index < 32U; ++point_index)
+        {
+            const hlslpp::float3 point(90.F * offset_distribution(rng), 10.F * offset_distribution(rng), 90.F * offset_distribution(rng));
+            CHECK(orbital_index.QueryNear(point, 10.F, elapsed_seconds) == linear_scan.QueryNear(point, 10.F));
+        }
+        CHECK(orbital_index.QueryNear(hlslpp::float3(0.F, 0.F, 0.F), 45.F, elapsed_seconds) == linear_scan.QueryNear(hlslpp::float3(0.F, 0.F, 0.F), 45.F));
+    }
+}
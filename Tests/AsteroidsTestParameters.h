@@ -0,0 +1,106 @@
+/******************************************************************************
+
+Copyright 2026 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: AsteroidsTestParameters.h
+Seeded asteroid belt parameters and parallel executor shared by tests,
+parameters are generated without meshes and textures.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Asteroid.h>
+
+#include <taskflow/taskflow.hpp>
+
+#include <random>
+#include <vector>
+#include <numbers>
+
+namespace Methane::Samples
+{
+
+using TestParameters      = std::vector<Asteroid::Parameters>;
+using TestMeshDepthMaxima = std::vector<float>;
+
+constexpr uint32_t g_test_mesh_count = 8U;
+
+// Asteroids are placed on orbits of the belt with radius and height distributions similar to the generated asteroids array
+[[nodiscard]]
+inline TestParameters GenerateTestParameters(uint32_t asteroids_count, uint32_t mesh_count, uint32_t random_seed)
+{
+    std::mt19937 rng(random_seed);
+    std::uniform_real_distribution<float>   orbit_radius_distribution(40.F, 80.F);
+    std::normal_distribution<float>         orbit_height_distribution(0.F, 3.F);
+    std::uniform_real_distribution<float>   scale_distribution(0.2F, 1.F);
+    std::uniform_real_distribution<float>   scale_proportion_distribution(0.8F, 1.2F);
+    std::uniform_real_distribution<float>   orbit_velocity_distribution(1.5F, 5.F);
+    std::uniform_real_distribution<float>   angle_distribution(0.F, 2.F * static_cast<float>(std::numbers::pi));
+    std::uniform_int_distribution<uint32_t> mesh_distribution(0U, mesh_count - 1U);
+
+    const Asteroid::ColorIndices color_indices = Asteroid::GetAsteroidRockColorIndices(0U, 0U);
+    TestParameters parameters;
+    parameters.reserve(asteroids_count);
+    for (uint32_t asteroid_index = 0U; asteroid_index < asteroids_count; ++asteroid_index)
+    {
+        const float          orbit_radius = orbit_radius_distribution(rng);
+        const float          orbit_height = orbit_height_distribution(rng);
+        const float          scale        = scale_distribution(rng);
+        const hlslpp::float3 scale_ratios = hlslpp::float3(scale_proportion_distribution(rng),
+                                                           scale_proportion_distribution(rng),
+                                                           scale_proportion_distribution(rng)) * scale;
+        parameters.emplace_back(Asteroid::Parameters
+        {
+            .index                  = asteroid_index,
+            .mesh_instance_index    = mesh_distribution(rng),
+            .texture_index          = 0U,
+            .colors                 = Asteroid::GetPaletteColors(color_indices),
+            .color_indices          = color_indices,
+            .scale_translate_matrix = hlslpp::mul(hlslpp::float4x4::scale(scale_ratios),
+                                                  hlslpp::float4x4::translation(orbit_radius, orbit_height, 0.F)),
+            .spin_axis              = hlslpp::float3(0.F, 1.F, 0.F),
+            .scale                  = scale,
+            .orbit_speed            = orbit_velocity_distribution(rng) / (scale * orbit_radius),
+            .spin_speed             = 1.F / scale,
+            .spin_angle_rad         = angle_distribution(rng),
+            .orbit_angle_rad        = angle_distribution(rng)
+        });
+    }
+    return parameters;
+}
+
+// Maximum vertex depths of test meshes are close to unit sphere of the generated asteroid meshes
+[[nodiscard]]
+inline TestMeshDepthMaxima GetTestMeshDepthMaxima()
+{
+    TestMeshDepthMaxima mesh_depth_maxima;
+    for (uint32_t mesh_index = 0U; mesh_index < g_test_mesh_count; ++mesh_index)
+    {
+        mesh_depth_maxima.push_back(1.F + static_cast<float>(mesh_index) * 0.05F);
+    }
+    return mesh_depth_maxima;
+}
+
+[[nodiscard]]
+inline tf::Executor& GetTestExecutor()
+{
+    static tf::Executor s_executor(4U);
+    return s_executor;
+}
+
+} // namespace Methane::Samples